@@ -0,0 +1,684 @@
+// Copyright (c) embedded ocean GmbH
+#include "Attributes.hpp"
+#include "Events.hpp"
+#include "ReconnectGovernor.hpp"
+#include "SimulatedDevice.hpp"
+#include "Tasks.hpp"
+#include "TemplateInput.hpp"
+#include "TemplateIoComponent.hpp"
+#include "TemplateOutput.hpp"
+
+#include <xentara/process/Event.hpp>
+#include <xentara/process/ExecutionContext.hpp>
+#include <xentara/process/Task.hpp>
+#include <xentara/skill/ElementFactory.hpp>
+#include <xentara/standin/Runtime.hpp>
+#include <xentara/utils/json/decoder/Object.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+namespace
+{
+
+/// @brief The settings of the load generator itself
+struct LoadSettings final
+{
+	/// @brief The number of inputs
+	std::size_t _inputCount { 100 };
+	/// @brief The number of outputs
+	std::size_t _outputCount { 10 };
+	/// @brief The number of threads the tasks are executed on
+	std::size_t _threadCount { 4 };
+	/// @brief The period of the tasks that read
+	std::chrono::milliseconds _readInterval { 100 };
+	/// @brief The period of the tasks that write, and the interval at which new values are written to the outputs
+	std::chrono::milliseconds _writeInterval { 100 };
+	/// @brief The period of the "reconnect" task
+	std::chrono::milliseconds _reconnectInterval { 100 };
+	/// @brief The period of the "publishStatistics" task
+	std::chrono::milliseconds _publishInterval { 100 };
+	/// @brief How long to generate load for
+	std::chrono::seconds _duration { 10 };
+	/// @brief Whether to use the "batchRead" and "batchWrite" tasks of the I/O component instead of the tasks of the data points
+	bool _batch { false };
+};
+
+/// @brief The complete configuration of a load test
+struct Configuration final
+{
+	/// @brief The settings of the load generator
+	LoadSettings _load;
+	/// @brief The behaviour of the simulated device
+	SimulatedDevice::Settings _simulator;
+	/// @brief Whether the simulated point count was set explicitly
+	bool _hasPointCount { false };
+	/// @brief The configuration parameters of the I/O component
+	utils::json::decoder::Object _ioComponent;
+	/// @brief The configuration parameters of each input
+	std::vector<std::pair<std::string, std::string>> _input;
+	/// @brief The configuration parameters of each output
+	std::vector<std::pair<std::string, std::string>> _output;
+};
+
+/// @brief Statistics about the executions of all tasks of a certain kind
+struct TaskStatistics final
+{
+	/// @brief The number of executions
+	std::uint64_t _executions { 0 };
+	/// @brief The total time spent executing
+	std::chrono::nanoseconds _totalDuration { 0 };
+	/// @brief The longest execution
+	std::chrono::nanoseconds _maxDuration { 0 };
+	/// @brief The largest delay between the scheduled time and the start of an execution
+	std::chrono::nanoseconds _maxLateness { 0 };
+
+	/// @brief Adds the statistics of other executions
+	auto merge(const TaskStatistics &other) -> void
+	{
+		_executions += other._executions;
+		_totalDuration += other._totalDuration;
+		_maxDuration = std::max(_maxDuration, other._maxDuration);
+		_maxLateness = std::max(_maxLateness, other._maxLateness);
+	}
+};
+
+/// @brief A periodic job executed by a worker thread
+struct Job final
+{
+	/// @brief The name the statistics are kept under
+	std::string_view _name;
+	/// @brief The task to execute, or nullptr if the job only calls _prepare
+	std::shared_ptr<process::Task> _task;
+	/// @brief A function that is called before the task is executed, or an empty function for none
+	std::function<void()> _prepare;
+	/// @brief The period
+	std::chrono::nanoseconds _period;
+	/// @brief The next time the job is due
+	std::chrono::steady_clock::time_point _nextTime;
+};
+
+/// @brief Prints the usage information
+auto printUsage(std::ostream &stream) -> void
+{
+	stream <<
+		"usage: xentara-template-driver-load-generator [setting | @file]...\n"
+		"\n"
+		"Each setting has the form section.name=value. Files contain one setting per line. Empty lines and lines\n"
+		"starting with # are ignored.\n"
+		"\n"
+		"Sections:\n"
+		"  load       settings of the load generator:\n"
+		"               inputs, outputs, threads, readInterval (ms), writeInterval (ms), reconnectInterval (ms),\n"
+		"               publishInterval (ms), duration (s), batch (true or false)\n"
+		"  simulator  behaviour of the simulated device:\n"
+		"               pointCount, latency (us), latencyJitter (us),\n"
+		"               latencyDistribution (fixed, uniform, normal, or exponential), changeRate (per second),\n"
+		"               errorRate, timeoutRate, disconnectRate, connectErrorRate (between 0 and 1)\n"
+		"  device     configuration parameters of the I/O component, e.g. device.maxOutstandingRequests=4\n"
+		"  input      configuration parameters of each input, e.g. input.reportByException=true\n"
+		"  output     configuration parameters of each output, e.g. output.writeQueueSize=16\n";
+}
+
+/// @brief Loads a probability setting, and checks that it is between 0 and 1
+auto loadProbability(const utils::json::decoder::Value &value, const std::string &name) -> double
+{
+	const auto probability = value.asNumber<double>();
+	if (probability < 0.0 || probability > 1.0)
+	{
+		throw std::runtime_error("simulator setting \"" + name + "\" must be between 0 and 1");
+	}
+
+	return probability;
+}
+
+/// @brief Applies a single setting of the simulator section
+auto applySimulatorSetting(Configuration &configuration, const std::string &name, const utils::json::decoder::Value &value) -> void
+{
+	auto &simulator = configuration._simulator;
+	if (name == "pointCount"sv)
+	{
+		simulator._pointCount = value.asNumber<std::uint32_t>();
+		configuration._hasPointCount = true;
+	}
+	else if (name == "latency"sv)
+	{
+		simulator._latency = std::chrono::microseconds(value.asNumber<std::uint32_t>());
+	}
+	else if (name == "latencyJitter"sv)
+	{
+		simulator._latencyJitter = std::chrono::microseconds(value.asNumber<std::uint32_t>());
+	}
+	else if (name == "latencyDistribution"sv)
+	{
+		const auto distribution = value.asString<std::string>();
+		if (distribution == "fixed"sv)
+		{
+			simulator._latencyDistribution = SimulatedDevice::LatencyDistribution::Fixed;
+		}
+		else if (distribution == "uniform"sv)
+		{
+			simulator._latencyDistribution = SimulatedDevice::LatencyDistribution::Uniform;
+		}
+		else if (distribution == "normal"sv)
+		{
+			simulator._latencyDistribution = SimulatedDevice::LatencyDistribution::Normal;
+		}
+		else if (distribution == "exponential"sv)
+		{
+			simulator._latencyDistribution = SimulatedDevice::LatencyDistribution::Exponential;
+		}
+		else
+		{
+			throw std::runtime_error("simulator setting \"latencyDistribution\" must be \"fixed\", \"uniform\", \"normal\", or \"exponential\"");
+		}
+	}
+	else if (name == "changeRate"sv)
+	{
+		simulator._changeRate = value.asNumber<double>();
+		if (simulator._changeRate < 0.0)
+		{
+			throw std::runtime_error("simulator setting \"changeRate\" must not be negative");
+		}
+	}
+	else if (name == "errorRate"sv)
+	{
+		simulator._errorRate = loadProbability(value, name);
+	}
+	else if (name == "timeoutRate"sv)
+	{
+		simulator._timeoutRate = loadProbability(value, name);
+	}
+	else if (name == "disconnectRate"sv)
+	{
+		simulator._disconnectRate = loadProbability(value, name);
+	}
+	else if (name == "connectErrorRate"sv)
+	{
+		simulator._connectErrorRate = loadProbability(value, name);
+	}
+	else
+	{
+		throw std::runtime_error("unknown simulator setting \"" + name + "\"");
+	}
+}
+
+/// @brief Applies a single setting of the form section.name=value to the configuration
+auto applySetting(Configuration &configuration, std::string_view setting) -> void
+{
+	const auto dot = setting.find('.');
+	const auto equals = setting.find('=');
+	if (dot == std::string_view::npos || equals == std::string_view::npos || equals < dot)
+	{
+		throw std::runtime_error("invalid setting \"" + std::string(setting) + "\"");
+	}
+	const auto section = setting.substr(0, dot);
+	const auto name = std::string(setting.substr(dot + 1, equals - dot - 1));
+	const auto text = std::string(setting.substr(equals + 1));
+
+	if (section == "device"sv)
+	{
+		configuration._ioComponent.add(name, text);
+		return;
+	}
+	else if (section == "input"sv)
+	{
+		configuration._input.emplace_back(name, text);
+		return;
+	}
+	else if (section == "output"sv)
+	{
+		configuration._output.emplace_back(name, text);
+		return;
+	}
+	else if (section == "simulator"sv)
+	{
+		applySimulatorSetting(configuration, name, utils::json::decoder::Value { text });
+		return;
+	}
+	else if (section != "load"sv)
+	{
+		throw std::runtime_error("unknown section \"" + std::string(section) + "\"");
+	}
+
+	const utils::json::decoder::Value value { text };
+	auto &load = configuration._load;
+	if (name == "inputs"sv)
+	{
+		load._inputCount = value.asNumber<std::size_t>();
+	}
+	else if (name == "outputs"sv)
+	{
+		load._outputCount = value.asNumber<std::size_t>();
+	}
+	else if (name == "threads"sv)
+	{
+		load._threadCount = std::max<std::size_t>(value.asNumber<std::size_t>(), 1);
+	}
+	else if (name == "readInterval"sv)
+	{
+		load._readInterval = std::chrono::milliseconds(std::max<std::uint32_t>(value.asNumber<std::uint32_t>(), 1));
+	}
+	else if (name == "writeInterval"sv)
+	{
+		load._writeInterval = std::chrono::milliseconds(std::max<std::uint32_t>(value.asNumber<std::uint32_t>(), 1));
+	}
+	else if (name == "reconnectInterval"sv)
+	{
+		load._reconnectInterval = std::chrono::milliseconds(std::max<std::uint32_t>(value.asNumber<std::uint32_t>(), 1));
+	}
+	else if (name == "publishInterval"sv)
+	{
+		load._publishInterval = std::chrono::milliseconds(std::max<std::uint32_t>(value.asNumber<std::uint32_t>(), 1));
+	}
+	else if (name == "duration"sv)
+	{
+		load._duration = std::chrono::seconds(value.asNumber<std::uint32_t>());
+	}
+	else if (name == "batch"sv)
+	{
+		load._batch = value.asBool();
+	}
+	else
+	{
+		throw std::runtime_error("unknown load setting \"" + name + "\"");
+	}
+}
+
+/// @brief Applies all the settings in a file
+auto applyFile(Configuration &configuration, const std::string &path) -> void
+{
+	std::ifstream file { path };
+	if (!file)
+	{
+		throw std::runtime_error("cannot open \"" + path + "\"");
+	}
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		// Strip leading and trailing white space
+		const auto begin = line.find_first_not_of(" \t\r");
+		if (begin == std::string::npos || line[begin] == '#')
+		{
+			continue;
+		}
+		const auto end = line.find_last_not_of(" \t\r");
+
+		applySetting(configuration, std::string_view(line).substr(begin, end + 1 - begin));
+	}
+}
+
+/// @brief Finds the task with a certain role
+auto findTask(skill::Element &element, const process::Task::Role &role) -> std::shared_ptr<process::Task>
+{
+	std::shared_ptr<process::Task> found;
+	element.forEachTask([&](const process::Task::Role &taskRole, std::shared_ptr<process::Task> task) {
+		if (&taskRole != &role)
+		{
+			return false;
+		}
+		found = std::move(task);
+		return true;
+	});
+	return found;
+}
+
+/// @brief Finds the event with a certain role
+auto findEvent(skill::Element &element, const process::Event::Role &role) -> std::shared_ptr<process::Event>
+{
+	std::shared_ptr<process::Event> found;
+	element.forEachEvent([&](const process::Event::Role &eventRole, std::shared_ptr<process::Event> event) {
+		if (&eventRole != &role)
+		{
+			return false;
+		}
+		found = std::move(event);
+		return true;
+	});
+	return found;
+}
+
+/// @brief Adds up how often the event with a certain role was raised by each of a number of elements
+auto countEvents(const std::vector<std::shared_ptr<skill::Element>> &elements, const process::Event::Role &role) -> std::uint64_t
+{
+	std::uint64_t count = 0;
+	for (auto &&element : elements)
+	{
+		if (const auto event = findEvent(*element, role))
+		{
+			count += event->raised();
+		}
+	}
+	return count;
+}
+
+/// @brief Executes jobs until the end time
+auto runJobs(std::vector<Job> &jobs,
+	std::chrono::steady_clock::time_point endTime,
+	std::chrono::steady_clock::time_point steadyStart,
+	std::chrono::system_clock::time_point systemStart) -> std::map<std::string_view, TaskStatistics>
+{
+	std::map<std::string_view, TaskStatistics> statistics;
+	if (jobs.empty())
+	{
+		return statistics;
+	}
+
+	for (;;)
+	{
+		// Execute the job that is due next
+		auto &job = *std::ranges::min_element(jobs, {}, &Job::_nextTime);
+		if (job._nextTime >= endTime)
+		{
+			break;
+		}
+		std::this_thread::sleep_until(job._nextTime);
+
+		const auto startTime = std::chrono::steady_clock::now();
+		if (job._prepare)
+		{
+			job._prepare();
+		}
+		if (job._task)
+		{
+			const auto scheduledTime =
+				systemStart + std::chrono::duration_cast<std::chrono::system_clock::duration>(job._nextTime - steadyStart);
+			job._task->operational(process::ExecutionContext(scheduledTime));
+		}
+		const auto finishTime = std::chrono::steady_clock::now();
+
+		auto &jobStatistics = statistics[job._name];
+		++jobStatistics._executions;
+		jobStatistics._totalDuration += finishTime - startTime;
+		jobStatistics._maxDuration = std::max<std::chrono::nanoseconds>(jobStatistics._maxDuration, finishTime - startTime);
+		jobStatistics._maxLateness = std::max<std::chrono::nanoseconds>(jobStatistics._maxLateness, startTime - job._nextTime);
+
+		// Skip any executions that were missed entirely, like a timer would
+		job._nextTime += job._period;
+		if (job._nextTime < finishTime)
+		{
+			job._nextTime += ((finishTime - job._nextTime) / job._period + 1) * job._period;
+		}
+	}
+
+	return statistics;
+}
+
+/// @brief Formats a duration in microseconds
+auto microseconds(std::chrono::nanoseconds duration) -> std::string
+{
+	std::ostringstream stream;
+	stream << std::fixed << std::setprecision(1) << std::chrono::duration<double, std::micro>(duration).count() << " us";
+	return stream.str();
+}
+
+/// @brief Runs a load test
+auto run(Configuration &configuration) -> void
+{
+	const auto &load = configuration._load;
+
+	// Give the simulated device just enough points for all the data points, unless configured otherwise
+	auto &simulator = configuration._simulator;
+	const auto dataPointCount = load._inputCount + load._outputCount;
+	if (!configuration._hasPointCount)
+	{
+		simulator._pointCount = std::uint32_t(std::max<std::size_t>(dataPointCount, 1));
+	}
+	else if (simulator._pointCount < dataPointCount)
+	{
+		throw std::runtime_error("the simulated device has fewer points than there are data points");
+	}
+	// Each request can only have one outcome
+	if (simulator._errorRate + simulator._timeoutRate + simulator._disconnectRate > 1.0)
+	{
+		throw std::runtime_error("the simulated error, timeout, and disconnect rates add up to more than 1");
+	}
+	SimulatedDevice::create(simulator);
+
+	// Create and load the elements. The data points are assigned consecutive addresses.
+	skill::ElementFactory factory;
+	ReconnectGovernor reconnectGovernor { 1 };
+	const auto ioComponent = factory.makeShared<TemplateIoComponent>(reconnectGovernor);
+	standin::Runtime::load(*ioComponent, configuration._ioComponent);
+
+	std::vector<std::shared_ptr<skill::Element>> inputs;
+	std::vector<std::shared_ptr<skill::Element>> outputs;
+	std::uint32_t address = 0;
+	const auto createDataPoints = [&](const skill::Element::Class &elementClass,
+		std::size_t count,
+		const std::vector<std::pair<std::string, std::string>> &parameters,
+		std::vector<std::shared_ptr<skill::Element>> &elements) {
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			utils::json::decoder::Object jsonObject;
+			jsonObject.add("address", std::to_string(address++));
+			for (auto &&[name, text] : parameters)
+			{
+				jsonObject.add(name, text);
+			}
+
+			auto element = ioComponent->createChildElement(elementClass, factory);
+			standin::Runtime::load(*element, jsonObject);
+			elements.push_back(std::move(element));
+		}
+	};
+	createDataPoints(TemplateInput::Class::instance(), load._inputCount, configuration._input, inputs);
+	createDataPoints(TemplateOutput::Class::instance(), load._outputCount, configuration._output, outputs);
+
+	// Realize the elements
+	standin::Runtime::realize(*ioComponent);
+	for (auto &&element : inputs)
+	{
+		standin::Runtime::realize(*element);
+	}
+	for (auto &&element : outputs)
+	{
+		standin::Runtime::realize(*element);
+	}
+
+	// Create the jobs. The I/O component comes first, so that its tasks are run first.
+	std::vector<Job> jobs;
+	jobs.push_back({ "reconnect"sv, findTask(*ioComponent, process::Task::kReconnect), {}, load._reconnectInterval, {} });
+	jobs.push_back({ "publishStatistics"sv, findTask(*ioComponent, tasks::kPublishStatistics), {}, load._publishInterval, {} });
+	if (load._batch)
+	{
+		jobs.push_back({ "batchRead"sv, findTask(*ioComponent, tasks::kBatchRead), {}, load._readInterval, {} });
+		jobs.push_back({ "batchWrite"sv, findTask(*ioComponent, tasks::kBatchWrite), {}, load._writeInterval, {} });
+	}
+	else
+	{
+		for (auto &&element : inputs)
+		{
+			jobs.push_back({ "read"sv, findTask(*element, tasks::kRead), {}, load._readInterval, {} });
+		}
+		for (auto &&element : outputs)
+		{
+			jobs.push_back({ "read"sv, findTask(*element, tasks::kRead), {}, load._readInterval, {} });
+		}
+	}
+	// Each output is given a new value before each write
+	for (auto &&element : outputs)
+	{
+		auto prepare = [handle = *element->makeWriteHandle(TemplateOutput::kValueAttribute), value = 0.0]() mutable {
+			handle.write(++value);
+		};
+		if (load._batch)
+		{
+			jobs.push_back({ "writeValue"sv, nullptr, std::move(prepare), load._writeInterval, {} });
+		}
+		else
+		{
+			jobs.push_back({ "write"sv, findTask(*element, tasks::kWrite), std::move(prepare), load._writeInterval, {} });
+		}
+	}
+
+	// Bring the tasks up
+	for (auto &&job : jobs)
+	{
+		if (job._task)
+		{
+			standin::Runtime::preOperational(*job._task);
+		}
+	}
+
+	// Spread the jobs over the threads, and spread the jobs of each thread over their period, so that they do not all
+	// execute at the same time
+	const auto steadyStart = std::chrono::steady_clock::now();
+	const auto systemStart = std::chrono::system_clock::now();
+	const auto endTime = steadyStart + load._duration;
+	std::vector<std::vector<Job>> threadJobs(load._threadCount);
+	for (std::size_t index = 0; index < jobs.size(); ++index)
+	{
+		auto &job = jobs[index];
+		job._nextTime = steadyStart + job._period * index / jobs.size();
+		threadJobs[index % load._threadCount].push_back(job);
+	}
+
+	// Run the jobs
+	std::vector<std::map<std::string_view, TaskStatistics>> threadStatistics(load._threadCount);
+	{
+		std::vector<std::jthread> threads;
+		for (std::size_t index = 0; index < load._threadCount; ++index)
+		{
+			threads.emplace_back([&, index]() {
+				threadStatistics[index] = runJobs(threadJobs[index], endTime, steadyStart, systemStart);
+			});
+		}
+	}
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - steadyStart).count();
+
+	// Bring the tasks down again
+	for (auto &&job : jobs)
+	{
+		if (job._task)
+		{
+			standin::Runtime::postOperational(*job._task);
+		}
+	}
+
+	// Report the task statistics
+	std::map<std::string_view, TaskStatistics> statistics;
+	for (auto &&threadStatistic : threadStatistics)
+	{
+		for (auto &&[name, taskStatistics] : threadStatistic)
+		{
+			statistics[name].merge(taskStatistics);
+		}
+	}
+
+	std::cout << load._inputCount << " inputs, " << load._outputCount << " outputs, " << load._threadCount << " threads, "
+			  << std::fixed << std::setprecision(1) << elapsed << " s, " << (load._batch ? "batch tasks" : "data point tasks")
+			  << "\n\n";
+
+	std::cout << std::left << std::setw(18) << "task" << std::right << std::setw(14) << "executions" << std::setw(14) << "per second"
+			  << std::setw(16) << "mean duration" << std::setw(16) << "max duration" << std::setw(16) << "max lateness" << "\n";
+	for (auto &&[name, taskStatistics] : statistics)
+	{
+		const auto meanDuration =
+			taskStatistics._executions > 0 ? taskStatistics._totalDuration / std::int64_t(taskStatistics._executions) : std::chrono::nanoseconds(0);
+		std::cout << std::left << std::setw(18) << name << std::right << std::setw(14) << taskStatistics._executions
+				  << std::setw(14) << std::setprecision(1) << double(taskStatistics._executions) / elapsed
+				  << std::setw(16) << microseconds(meanDuration) << std::setw(16) << microseconds(taskStatistics._maxDuration)
+				  << std::setw(16) << microseconds(taskStatistics._maxLateness) << "\n";
+	}
+
+	// Report the events
+	std::vector<std::shared_ptr<skill::Element>> dataPoints = inputs;
+	dataPoints.insert(dataPoints.end(), outputs.begin(), outputs.end());
+	const auto changes = countEvents(dataPoints, process::Event::kChanged);
+	const auto writes = countEvents(outputs, events::kWritten);
+	const auto connects = findEvent(*ioComponent, process::Event::kConnected)->raised();
+	const auto disconnects = findEvent(*ioComponent, process::Event::kDisconnected)->raised();
+
+	std::cout << "\nvalue changes:   " << changes << " (" << double(changes) / elapsed << " per second)\n"
+			  << "values written:  " << writes << " (" << double(writes) / elapsed << " per second)\n"
+			  << "connects:        " << connects << "\n"
+			  << "disconnects:     " << disconnects << "\n";
+
+	// Report the statistics the I/O component published for the last statistics window
+	const auto read = [&](const model::Attribute &attribute) { return *ioComponent->makeReadHandle(attribute); };
+	std::cout << "\nI/O component statistics for the last statistics window:\n"
+			  << "reads per second:   " << read(attributes::kReadsPerSecond).read<double>() << "\n"
+			  << "writes per second:  " << read(attributes::kWritesPerSecond).read<double>() << "\n"
+			  << "round trip:         " << microseconds(read(attributes::kRoundTripMin).read<std::chrono::nanoseconds>()) << " min, "
+			  << microseconds(read(attributes::kRoundTripAverage).read<std::chrono::nanoseconds>()) << " average, "
+			  << microseconds(read(attributes::kRoundTripMax).read<std::chrono::nanoseconds>()) << " max\n"
+			  << "timeout errors:     " << read(attributes::kTimeoutErrors).read<std::uint64_t>() << "\n"
+			  << "connection errors:  " << read(attributes::kConnectionErrors).read<std::uint64_t>() << "\n"
+			  << "request errors:     " << read(attributes::kRequestErrors).read<std::uint64_t>() << "\n"
+			  << "write latency:      " << microseconds(read(attributes::kWriteLatencyP50).read<std::chrono::nanoseconds>()) << " p50, "
+			  << microseconds(read(attributes::kWriteLatencyP99).read<std::chrono::nanoseconds>()) << " p99, "
+			  << microseconds(read(attributes::kWriteLatencyMax).read<std::chrono::nanoseconds>()) << " max\n";
+
+	// Destroy the data points before the I/O component they are attached to
+	jobs.clear();
+	threadJobs.clear();
+	inputs.clear();
+	outputs.clear();
+	dataPoints.clear();
+}
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver
+
+auto main(int argc, char *argv[]) -> int
+{
+	using namespace xentara::plugins::templateDriver;
+
+	try
+	{
+		// Collect the settings
+		Configuration configuration;
+		for (int index = 1; index < argc; ++index)
+		{
+			const std::string_view argument { argv[index] };
+			if (argument == "--help"sv || argument == "-h"sv)
+			{
+				printUsage(std::cout);
+				return EXIT_SUCCESS;
+			}
+			else if (argument.starts_with('@'))
+			{
+				applyFile(configuration, std::string(argument.substr(1)));
+			}
+			else
+			{
+				applySetting(configuration, argument);
+			}
+		}
+
+		run(configuration);
+	}
+	catch (const std::exception &exception)
+	{
+		std::cerr << "error: " << exception.what() << "\n\n";
+		printUsage(std::cerr);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
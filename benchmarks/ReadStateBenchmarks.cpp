@@ -0,0 +1,88 @@
+// Copyright (c) embedded ocean GmbH
+#include "ReadState.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+namespace
+{
+
+/// @brief Updates a read state with a different value each time, so that every update commits and raises the changed event
+auto readStateUpdateChanged(benchmark::State &state) -> void
+{
+	ReadState<double> readState;
+	readState.realize();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	double value = 0;
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		value += 1;
+		readState.update(timeStamp, value);
+	}
+}
+
+/// @brief Updates a read state with the same value each time, so that every update commits without raising an event
+auto readStateUpdateUnchanged(benchmark::State &state) -> void
+{
+	ReadState<double> readState;
+	readState.realize();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	readState.update(timeStamp, 42.0);
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		readState.update(timeStamp, 42.0);
+	}
+}
+
+/// @brief Updates a read state with the same value each time in report by exception mode, so that every update is skipped
+auto readStateUpdateUnchangedReportByException(benchmark::State &state) -> void
+{
+	ReadState<double> readState;
+	readState.setReportByException(true, 0s);
+	readState.realize();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	readState.update(timeStamp, 42.0);
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		readState.update(timeStamp, 42.0);
+	}
+}
+
+/// @brief Updates a read state with values that are all within the deadband, so that only the update time changes
+auto readStateUpdateWithinDeadband(benchmark::State &state) -> void
+{
+	ReadState<double> readState;
+	readState.setChangeFilter({ ._absoluteDeadband = 1.0 });
+	readState.realize();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	readState.update(timeStamp, 42.0);
+	double offset = 0.5;
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		offset = -offset;
+		readState.update(timeStamp, 42.0 + offset);
+	}
+}
+
+BENCHMARK(readStateUpdateChanged);
+BENCHMARK(readStateUpdateUnchanged);
+BENCHMARK(readStateUpdateUnchangedReportByException);
+BENCHMARK(readStateUpdateWithinDeadband);
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,267 @@
+// Copyright (c) embedded ocean GmbH
+#include "SimulatedDevice.hpp"
+
+#include "CustomError.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <system_error>
+#include <thread>
+
+#ifdef _WIN32
+#	include <Windows.h>
+#else
+#	include <errno.h>
+#endif
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief The random number engine of the current thread. Each thread has its own, so that drawing needs no locking.
+thread_local std::minstd_rand tRandomEngine { std::random_device()() };
+
+/// @brief Draws a random number between 0 and 1
+auto drawProbability() -> double
+{
+	return std::uniform_real_distribution<double> { 0.0, 1.0 }(tRandomEngine);
+}
+
+/// @brief Makes a system error with the given platform specific error number
+auto systemError(int errorNumber) -> std::system_error
+{
+	return std::system_error(errorNumber, std::system_category());
+}
+
+/// @brief The device created using SimulatedDevice::create()
+std::unique_ptr<SimulatedDevice> gInstance;
+
+} // namespace
+
+SimulatedDevice::SimulatedDevice(const Settings &settings) : _settings(settings), _points(settings._pointCount)
+{
+}
+
+auto SimulatedDevice::create(const Settings &settings) -> SimulatedDevice &
+{
+	gInstance = std::make_unique<SimulatedDevice>(settings);
+	return *gInstance;
+}
+
+auto SimulatedDevice::instance() noexcept -> SimulatedDevice &
+{
+	return *gInstance;
+}
+
+auto SimulatedDevice::connect() -> void
+{
+	// Connecting takes as long as a request
+	std::this_thread::sleep_for(drawLatency());
+
+	if (drawProbability() < _settings._connectErrorRate)
+	{
+#ifdef _WIN32
+		throw systemError(WSAECONNREFUSED);
+#else
+		throw systemError(ECONNREFUSED);
+#endif
+	}
+
+	// Discard any responses from an earlier connection
+	{
+		std::scoped_lock lock { _mutex };
+		_pendingRequests.clear();
+	}
+
+	_connected.store(true, std::memory_order_release);
+}
+
+auto SimulatedDevice::disconnect() noexcept -> void
+{
+	_connected.store(false, std::memory_order_release);
+
+	std::scoped_lock lock { _mutex };
+	_pendingRequests.clear();
+}
+
+auto SimulatedDevice::request(std::chrono::steady_clock::time_point sendTime) -> void
+{
+	checkConnected();
+
+	complete(sendTime + drawLatency(), drawOutcome());
+}
+
+auto SimulatedDevice::send(std::uint64_t tag) -> void
+{
+	checkConnected();
+
+	const PendingRequest request { tag, std::chrono::steady_clock::now() + drawLatency(), drawOutcome() };
+
+	std::scoped_lock lock { _mutex };
+	_pendingRequests.push_back(request);
+}
+
+auto SimulatedDevice::receive() -> std::uint64_t
+{
+	// Take the request that completes first
+	PendingRequest request;
+	{
+		std::scoped_lock lock { _mutex };
+
+		// If there are no requests, they were discarded because the connection was closed
+		if (_pendingRequests.empty())
+		{
+			throw std::system_error(CustomError::NotConnected);
+		}
+
+		const auto next = std::ranges::min_element(_pendingRequests, {}, &PendingRequest::_dueTime);
+		request = *next;
+		_pendingRequests.erase(next);
+	}
+
+	complete(request._dueTime, request._outcome);
+	return request._tag;
+}
+
+auto SimulatedDevice::sendPointRequest(std::uint32_t address) -> void
+{
+	checkConnected();
+
+	_points[address]._requestTime.store(std::chrono::steady_clock::now(), std::memory_order_relaxed);
+}
+
+auto SimulatedDevice::receivePointResponse(std::uint32_t address) -> double
+{
+	// Count the latency from the time the request was sent, so that the time the point spent waiting for the response
+	// overlaps with whatever it did in between
+	request(_points[address]._requestTime.load(std::memory_order_relaxed));
+
+	return value(address);
+}
+
+auto SimulatedDevice::value(std::uint32_t address) const noexcept -> double
+{
+	const auto &point = _points[address];
+
+	// Use the written value, if there is one
+	if (point._written.load(std::memory_order_acquire))
+	{
+		return point._value.load(std::memory_order_relaxed);
+	}
+
+	// Count the changes since the start. Each point is offset by a different fraction of a period, so that the points
+	// don't all change at the same time.
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - _startTime).count();
+	const auto phase = std::fmod(double(address) * 0.6180339887498949, 1.0);
+	return std::floor(elapsed * _settings._changeRate + phase);
+}
+
+auto SimulatedDevice::setValue(std::uint32_t address, double value) noexcept -> void
+{
+	auto &point = _points[address];
+	point._value.store(value, std::memory_order_relaxed);
+	point._written.store(true, std::memory_order_release);
+}
+
+auto SimulatedDevice::drawLatency() const -> std::chrono::steady_clock::duration
+{
+	const auto latency = double(_settings._latency.count());
+	const auto jitter = double(_settings._latencyJitter.count());
+
+	double microseconds = latency;
+	switch (_settings._latencyDistribution)
+	{
+	case LatencyDistribution::Fixed:
+		break;
+
+	case LatencyDistribution::Uniform:
+		microseconds = std::uniform_real_distribution<double> { latency - jitter, latency + jitter }(tRandomEngine);
+		break;
+
+	case LatencyDistribution::Normal:
+		if (jitter > 0)
+		{
+			microseconds = std::normal_distribution<double> { latency, jitter }(tRandomEngine);
+		}
+		break;
+
+	case LatencyDistribution::Exponential:
+		if (latency > 0)
+		{
+			microseconds = std::exponential_distribution<double> { 1.0 / latency }(tRandomEngine);
+		}
+		break;
+	}
+
+	// Requests cannot complete before they were sent
+	return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+		std::chrono::duration<double, std::micro>(std::max(microseconds, 0.0)));
+}
+
+auto SimulatedDevice::drawOutcome() const -> Outcome
+{
+	// Use a single draw for all outcomes, so that the rates add up
+	auto probability = drawProbability();
+
+	if (probability < _settings._disconnectRate)
+	{
+		return Outcome::Disconnect;
+	}
+	probability -= _settings._disconnectRate;
+
+	if (probability < _settings._timeoutRate)
+	{
+		return Outcome::Timeout;
+	}
+	probability -= _settings._timeoutRate;
+
+	if (probability < _settings._errorRate)
+	{
+		return Outcome::Rejected;
+	}
+
+	return Outcome::Success;
+}
+
+auto SimulatedDevice::checkConnected() const -> void
+{
+	if (!_connected.load(std::memory_order_acquire))
+	{
+		throw std::system_error(CustomError::NotConnected);
+	}
+}
+
+auto SimulatedDevice::complete(std::chrono::steady_clock::time_point dueTime, Outcome outcome) -> void
+{
+	std::this_thread::sleep_until(dueTime);
+
+	// The connection may have been lost while we were waiting
+	checkConnected();
+
+	switch (outcome)
+	{
+	case Outcome::Success:
+		return;
+
+	case Outcome::Rejected:
+		throw std::system_error(CustomError::RequestRejected);
+
+	case Outcome::Timeout:
+		throw std::system_error(std::make_error_code(std::errc::timed_out));
+
+	case Outcome::Disconnect:
+		// Drop the connection for everyone
+		disconnect();
+#ifdef _WIN32
+		throw systemError(WSAECONNRESET);
+#else
+		throw systemError(ECONNRESET);
+#endif
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
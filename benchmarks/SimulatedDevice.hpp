@@ -0,0 +1,189 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief An in-process stand-in for a physical device, used for load testing without the real hardware.
+///
+/// The device has a fixed number of points, each of which holds a single value. Every request takes a random amount of time
+/// to complete, and can be made to fail at random, either on its own, or by dropping the connection.
+///
+/// Points that were never written change their value at a fixed rate. The values are computed from the time, so that no
+/// background thread is needed to change them. Once a point was written, it keeps the written value.
+///
+/// Requests made using request() block the calling thread until they complete. Requests made using send() are pipelined,
+/// and must be completed using receive(). Responses are received in the order they complete, which is not necessarily the
+/// order the requests were sent in. Each point can also have a single request of its own in flight, which is sent using
+/// sendPointRequest() and completed using receivePointResponse().
+///
+/// The load generator creates a single device using create(), which the device handle of the driver then talks to
+/// instead of the physical device.
+///
+/// This class is thread-safe, except that send() and receive() must only be used by one thread at a time.
+class SimulatedDevice final
+{
+public:
+	/// @brief The distribution the request latencies are drawn from
+	enum class LatencyDistribution
+	{
+		/// @brief All requests take exactly the latency
+		Fixed,
+		/// @brief The latencies are spread evenly around the latency, by up to the jitter in either direction
+		Uniform,
+		/// @brief The latencies are normally distributed around the latency, with the jitter as standard deviation
+		Normal,
+		/// @brief The latencies are exponentially distributed, with the latency as mean. The jitter is ignored.
+		Exponential
+	};
+
+	/// @brief The behaviour of the device
+	struct Settings final
+	{
+		/// @brief The number of points. Valid addresses go from 0 to one less than this.
+		std::uint32_t _pointCount { 1024 };
+		/// @brief The typical time a request takes to complete
+		std::chrono::microseconds _latency { 0 };
+		/// @brief The spread of the request times
+		std::chrono::microseconds _latencyJitter { 0 };
+		/// @brief The distribution the request times are drawn from
+		LatencyDistribution _latencyDistribution { LatencyDistribution::Fixed };
+		/// @brief The number of times per second the value of each point changes, if it was never written
+		double _changeRate { 1.0 };
+		/// @brief The probability that a request is rejected by the device
+		double _errorRate { 0 };
+		/// @brief The probability that a request times out
+		double _timeoutRate { 0 };
+		/// @brief The probability that a request drops the connection
+		double _disconnectRate { 0 };
+		/// @brief The probability that a connection attempt fails
+		double _connectErrorRate { 0 };
+	};
+
+	/// @brief Creates a device that is not connected
+	explicit SimulatedDevice(const Settings &settings);
+
+	/// @brief Creates the device that all device handles talk to, replacing any device created before
+	static auto create(const Settings &settings) -> SimulatedDevice &;
+
+	/// @brief Gets the device created using create()
+	static auto instance() noexcept -> SimulatedDevice &;
+
+	/// @brief Gets the number of points
+	auto pointCount() const noexcept -> std::uint32_t
+	{
+		return _settings._pointCount;
+	}
+
+	/// @brief Checks whether the device is connected
+	auto connected() const noexcept -> bool
+	{
+		return _connected.load(std::memory_order_acquire);
+	}
+
+	/// @brief Establishes the connection
+	/// @throw std::system_error The connection attempt failed
+	auto connect() -> void;
+
+	/// @brief Closes the connection. All requests that have not been received yet are discarded.
+	auto disconnect() noexcept -> void;
+
+	/// @brief Performs a request, and waits for it to complete
+	/// @param sendTime The time the request was sent. The latency is counted from this time, so that the response to
+	/// a request sent earlier can be collected later.
+	/// @throw std::system_error The request failed
+	auto request(std::chrono::steady_clock::time_point sendTime) -> void;
+
+	/// @brief Sends a request without waiting for it to complete
+	/// @param tag A value that is returned by receive() when the request completes
+	/// @throw std::system_error The device is not connected
+	auto send(std::uint64_t tag) -> void;
+
+	/// @brief Waits for the next request sent using send() to complete
+	/// @return The tag of the request
+	/// @throw std::system_error The request failed, or no request is outstanding
+	auto receive() -> std::uint64_t;
+
+	/// @brief Sends a request for a single point without waiting for it to complete
+	/// @param address The address of the point. This must be less than pointCount().
+	/// @throw std::system_error The device is not connected
+	auto sendPointRequest(std::uint32_t address) -> void;
+
+	/// @brief Waits for the request sent for a point using sendPointRequest() to complete
+	/// @param address The address of the point. This must be less than pointCount().
+	/// @return The current value of the point
+	/// @throw std::system_error The request failed
+	auto receivePointResponse(std::uint32_t address) -> double;
+
+	/// @brief Gets the current value of a point
+	/// @param address The address of the point. This must be less than pointCount().
+	auto value(std::uint32_t address) const noexcept -> double;
+
+	/// @brief Sets the value of a point
+	/// @param address The address of the point. This must be less than pointCount().
+	auto setValue(std::uint32_t address, double value) noexcept -> void;
+
+private:
+	/// @brief The possible results of a request
+	enum class Outcome
+	{
+		Success,
+		Rejected,
+		Timeout,
+		Disconnect
+	};
+
+	/// @brief A request sent using send()
+	struct PendingRequest final
+	{
+		/// @brief The tag of the request
+		std::uint64_t _tag { 0 };
+		/// @brief The time the request completes
+		std::chrono::steady_clock::time_point _dueTime;
+		/// @brief The result of the request
+		Outcome _outcome { Outcome::Success };
+	};
+
+	/// @brief A single point
+	struct Point final
+	{
+		/// @brief Whether the point was ever written
+		std::atomic<bool> _written { false };
+		/// @brief The value last written
+		std::atomic<double> _value { 0 };
+		/// @brief The time the last request sent using sendPointRequest() was sent
+		std::atomic<std::chrono::steady_clock::time_point> _requestTime;
+	};
+
+	/// @brief Draws the time a request takes
+	auto drawLatency() const -> std::chrono::steady_clock::duration;
+	/// @brief Draws the result of a request
+	auto drawOutcome() const -> Outcome;
+	/// @brief Throws an error if the device is not connected
+	auto checkConnected() const -> void;
+	/// @brief Waits for a request to complete, and throws the appropriate error if it failed
+	auto complete(std::chrono::steady_clock::time_point dueTime, Outcome outcome) -> void;
+
+	/// @brief The behaviour of the device
+	Settings _settings;
+	/// @brief The time the values of the points are computed from
+	std::chrono::steady_clock::time_point _startTime { std::chrono::steady_clock::now() };
+	/// @brief Whether the device is connected
+	std::atomic<bool> _connected { false };
+
+	/// @brief The points
+	std::vector<Point> _points;
+
+	/// @brief A mutex protecting _pendingRequests
+	std::mutex _mutex;
+	/// @brief The requests sent using send() that have not been received yet
+	std::vector<PendingRequest> _pendingRequests;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
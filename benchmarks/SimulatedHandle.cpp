@@ -0,0 +1,139 @@
+// Copyright (c) embedded ocean GmbH
+
+// This file takes the place of Handle.cpp in the load generator, so that the driver talks to the simulated device
+// instead of the physical device.
+
+#include "Handle.hpp"
+
+#include "CustomError.hpp"
+#include "SimulatedDevice.hpp"
+
+#include <chrono>
+#include <system_error>
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief Gets the simulated device
+auto device() noexcept -> SimulatedDevice &
+{
+	return SimulatedDevice::instance();
+}
+
+/// @brief Rejects requests for addresses the device does not have, like a physical device would
+auto checkRange(const AddressRange &range) -> void
+{
+	if (std::uint64_t(range._address) + range._size > device().pointCount())
+	{
+		throw std::system_error(CustomError::RequestRejected);
+	}
+}
+
+/// @brief Rejects requests for addresses the device does not have
+auto checkRanges(std::span<const AddressRange> ranges) -> void
+{
+	for (auto &&range : ranges)
+	{
+		checkRange(range);
+	}
+}
+
+} // namespace
+
+auto Handle::open() -> Handle
+{
+	device().connect();
+	return Handle();
+}
+
+Handle::operator bool() const noexcept
+{
+	return device().connected();
+}
+
+auto Handle::close() noexcept -> void
+{
+	device().disconnect();
+}
+
+auto Handle::read(const AddressRange &range) const -> double
+{
+	checkRange(range);
+	device().request(std::chrono::steady_clock::now());
+	return device().value(range._address);
+}
+
+auto Handle::sendReadRequest(const AddressRange &range) const -> void
+{
+	checkRange(range);
+	device().sendPointRequest(range._address);
+}
+
+auto Handle::receiveReadResponse(const AddressRange &range) const -> double
+{
+	checkRange(range);
+	return device().receivePointResponse(range._address);
+}
+
+auto Handle::sendBlockRequest(std::uint64_t transactionId, const AddressRange &block) const -> void
+{
+	checkRange(block);
+	device().send(transactionId);
+}
+
+auto Handle::receiveBlockResponse(std::span<std::byte>) const -> std::optional<std::uint64_t>
+{
+	// The values are taken from the device directly by decodeValue(), so there is nothing to put in the buffer
+	return device().receive();
+}
+
+auto Handle::decodeValue(std::span<const std::byte>, const AddressRange &, const AddressRange &range) const -> double
+{
+	return device().value(range._address);
+}
+
+auto Handle::write(const AddressRange &range, double value) const -> void
+{
+	checkRange(range);
+	device().request(std::chrono::steady_clock::now());
+	device().setValue(range._address, value);
+}
+
+auto Handle::writeSequence(const AddressRange &range, std::span<const double> values) const -> void
+{
+	checkRange(range);
+	device().request(std::chrono::steady_clock::now());
+	for (auto &&value : values)
+	{
+		device().setValue(range._address, value);
+	}
+}
+
+auto Handle::writeAndReadBack(const AddressRange &range, double value) const -> double
+{
+	checkRange(range);
+	device().request(std::chrono::steady_clock::now());
+	device().setValue(range._address, value);
+	return device().value(range._address);
+}
+
+auto Handle::writeBlock(std::span<const AddressRange> ranges, std::span<const double> values) const -> void
+{
+	checkRanges(ranges);
+	device().request(std::chrono::steady_clock::now());
+	for (std::size_t index = 0; index < ranges.size(); ++index)
+	{
+		device().setValue(ranges[index]._address, values[index]);
+	}
+}
+
+auto Handle::writeTransaction(std::span<const AddressRange> ranges, std::span<const double> values) const -> void
+{
+	// The simulated device applies all values of a request at once anyway
+	writeBlock(ranges, values);
+}
+
+} // namespace xentara::plugins::templateDriver
@@ -0,0 +1,61 @@
+// Copyright (c) embedded ocean GmbH
+#include "SingleValueQueue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief A value that is too large for a lock-free atomic, so that the triple-buffered queue is used
+using LargeValue = std::array<double, 4>;
+
+/// @brief Enqueues and dequeues a value on a single thread
+template <typename Queue, typename Value>
+auto singleValueQueueUncontended(benchmark::State &state) -> void
+{
+	Queue queue;
+	Value value {};
+	for (auto _ : state)
+	{
+		queue.enqueue(value);
+		benchmark::DoNotOptimize(queue.dequeue());
+	}
+}
+
+/// @brief Enqueues values from all threads but the first, which dequeues them, like an output written by several
+/// Xentara threads at once.
+///
+/// The queue is shared by all threads, and is constructed before the first iteration, because the threads start their
+/// iterations together.
+template <typename Queue, typename Value>
+auto singleValueQueueContended(benchmark::State &state) -> void
+{
+	static Queue queue;
+
+	Value value {};
+	for (auto _ : state)
+	{
+		if (state.thread_index() == 0)
+		{
+			benchmark::DoNotOptimize(queue.dequeue());
+		}
+		else
+		{
+			queue.enqueue(value);
+		}
+	}
+}
+
+BENCHMARK(singleValueQueueUncontended<SingleValueQueue<double>, double>);
+BENCHMARK(singleValueQueueUncontended<SingleValueQueue<LargeValue>, LargeValue>);
+BENCHMARK(singleValueQueueContended<SingleValueQueue<double>, double>)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK(singleValueQueueContended<SingleValueQueue<LargeValue>, LargeValue>)->ThreadRange(2, 8)->UseRealTime();
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,205 @@
+// Copyright (c) embedded ocean GmbH
+#include "TemplateIoComponent.hpp"
+
+#include "ReconnectGovernor.hpp"
+#include "TemplateInput.hpp"
+
+#include <xentara/skill/ElementFactory.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <barrier>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#	include <Windows.h>
+#else
+#	include <errno.h>
+#endif
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+namespace
+{
+
+/// @brief An I/O component with a number of inputs attached to it as error sinks
+class Device final
+{
+public:
+	/// @brief Creates the I/O component and the inputs
+	/// @param inputCount The number of inputs to attach
+	explicit Device(std::size_t inputCount) :
+		_ioComponent(_factory.makeShared<TemplateIoComponent>(_reconnectGovernor))
+	{
+		_inputs.reserve(inputCount);
+		for (std::size_t index = 0; index < inputCount; ++index)
+		{
+			_inputs.push_back(_ioComponent->createChildElement(TemplateInput::Class::instance(), _factory));
+		}
+	}
+
+	/// @brief Destroys the inputs before the I/O component they are attached to
+	~Device()
+	{
+		_inputs.clear();
+	}
+
+	/// @brief Gets the I/O component
+	auto ioComponent() noexcept -> TemplateIoComponent &
+	{
+		return *_ioComponent;
+	}
+
+private:
+	/// @brief The factory used to create the elements
+	skill::ElementFactory _factory;
+	/// @brief The governor. This does not limit anything, because only one I/O component exists.
+	ReconnectGovernor _reconnectGovernor { 1 };
+	/// @brief The I/O component
+	std::shared_ptr<TemplateIoComponent> _ioComponent;
+	/// @brief The inputs
+	std::vector<std::shared_ptr<skill::Element>> _inputs;
+};
+
+/// @brief Makes an error that affects the connection as a whole
+auto connectionError() -> std::error_code
+{
+#ifdef _WIN32
+	return { WSAECONNRESET, std::system_category() };
+#else
+	return { ECONNRESET, std::system_category() };
+#endif
+}
+
+/// @brief Connects and disconnects an I/O component, which notifies all error sinks of both state changes.
+///
+/// The number of error sinks is given by the first argument. The items processed are the notifications of the error sinks.
+auto updateStateFanOut(benchmark::State &state) -> void
+{
+	const auto sinkCount = std::size_t(state.range(0));
+	Device device { sinkCount };
+	auto &ioComponent = device.ioComponent();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		ioComponent.requestConnect(timeStamp);
+		timeStamp += 1ms;
+		ioComponent.requestDisconnect(timeStamp);
+	}
+
+	state.SetItemsProcessed(state.iterations() * std::int64_t(sinkCount) * 2);
+}
+
+/// @brief Connects an I/O component, reports a burst of connection errors, like all the data points of a device that
+/// has just gone away, and disconnects it again.
+///
+/// The number of error sinks is given by the first argument, and the number of errors in each burst by the second one.
+/// The items processed are the errors reported.
+auto handleErrorStorm(benchmark::State &state) -> void
+{
+	const auto sinkCount = std::size_t(state.range(0));
+	const auto errorCount = std::size_t(state.range(1));
+	Device device { sinkCount };
+	auto &ioComponent = device.ioComponent();
+	const auto error = connectionError();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		ioComponent.requestConnect(timeStamp);
+		timeStamp += 1ms;
+		for (std::size_t index = 0; index < errorCount; ++index)
+		{
+			ioComponent.handleError(timeStamp, error);
+		}
+		timeStamp += 1ms;
+		ioComponent.requestDisconnect(timeStamp);
+	}
+
+	state.SetItemsProcessed(state.iterations() * std::int64_t(errorCount));
+}
+
+/// @brief Reports connection errors from several threads at once to a connected I/O component, like data points on different
+/// threads that all notice that the device has gone away.
+///
+/// In each iteration, every thread reports one error. The first error to arrive closes the connection and notifies all the
+/// error sinks, and the others take the early out. The first thread then reconnects the I/O component, so the next iteration
+/// takes the first error path again. The threads wait for each other twice per iteration, and the time spent waiting is
+/// included in the measurement. The number of error sinks is given by the first argument. The items processed are the
+/// errors reported.
+///
+/// The I/O component is shared by all threads, and is set up and torn down by the first thread, because the threads start
+/// and finish their iterations together.
+auto handleErrorStormContended(benchmark::State &state) -> void
+{
+	static std::optional<Device> device;
+	static std::optional<std::barrier<>> barrier;
+	const auto error = connectionError();
+	auto timeStamp = std::chrono::system_clock::now();
+	const char *failure = nullptr;
+
+	if (state.thread_index() == 0)
+	{
+		device.emplace(std::size_t(state.range(0)));
+		barrier.emplace(std::ptrdiff_t(state.threads()));
+		device->ioComponent().requestConnect(timeStamp);
+	}
+
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		auto &ioComponent = device->ioComponent();
+		ioComponent.handleError(timeStamp, error);
+		barrier->arrive_and_wait();
+
+		// Make sure the error really took the connection down, and reconnect for the next iteration
+		if (state.thread_index() == 0)
+		{
+			if (ioComponent.connected())
+			{
+				failure = "the error did not close the connection";
+			}
+			ioComponent.requestDisconnect(timeStamp);
+			ioComponent.requestConnect(timeStamp);
+			if (!ioComponent.connected())
+			{
+				failure = "the I/O component did not reconnect";
+			}
+		}
+		barrier->arrive_and_wait();
+	}
+
+	state.SetItemsProcessed(state.iterations());
+
+	if (state.thread_index() == 0)
+	{
+		// The error is only reported now, because stopping the first thread early would leave the others waiting for it
+		if (failure)
+		{
+			state.SkipWithError(failure);
+		}
+
+		device->ioComponent().requestDisconnect(timeStamp);
+		barrier.reset();
+		device.reset();
+	}
+}
+
+BENCHMARK(updateStateFanOut)->RangeMultiplier(16)->Range(1, 4096);
+BENCHMARK(handleErrorStorm)->ArgsProduct({ { 1, 64, 4096 }, { 1, 64, 4096 } });
+BENCHMARK(handleErrorStormContended)->Arg(64)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
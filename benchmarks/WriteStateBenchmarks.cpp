@@ -0,0 +1,75 @@
+// Copyright (c) embedded ocean GmbH
+#include "WriteState.hpp"
+
+#include "CustomError.hpp"
+
+#include <xentara/process/EventList.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <system_error>
+
+namespace xentara::plugins::templateDriver
+{
+
+using namespace std::literals;
+
+namespace
+{
+
+/// @brief Records a successful write each time
+auto writeStateUpdate(benchmark::State &state) -> void
+{
+	WriteState writeState;
+	writeState.realize();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		writeState.update(timeStamp, std::error_code());
+	}
+}
+
+/// @brief Records alternating successful and failed writes
+auto writeStateUpdateAlternatingError(benchmark::State &state) -> void
+{
+	WriteState writeState;
+	writeState.realize();
+
+	auto timeStamp = std::chrono::system_clock::now();
+	bool failed = false;
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		failed = !failed;
+		writeState.update(timeStamp, failed ? std::error_code(CustomError::NotConnected) : std::error_code());
+	}
+}
+
+/// @brief Records a successful write each time, leaving the events to the caller like the "batchWrite" task does
+auto writeStateUpdateWithEventList(benchmark::State &state) -> void
+{
+	WriteState writeState;
+	writeState.realize();
+
+	process::DynamicEventList events;
+	events.reserve(1);
+
+	auto timeStamp = std::chrono::system_clock::now();
+	for (auto _ : state)
+	{
+		timeStamp += 1ms;
+		events.clear();
+		writeState.update(timeStamp, std::error_code(), events);
+	}
+}
+
+BENCHMARK(writeStateUpdate);
+BENCHMARK(writeStateUpdateAlternatingError);
+BENCHMARK(writeStateUpdateWithEventList);
+
+} // namespace
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,51 @@
+// Copyright (c) embedded ocean GmbH
+#include <xentara/data/DataType.hpp>
+#include <xentara/model/Attribute.hpp>
+#include <xentara/process/Event.hpp>
+#include <xentara/process/Task.hpp>
+#include <xentara/utils/core/Uuid.hpp>
+
+#include <string_view>
+
+namespace xentara::data
+{
+
+const DataType DataType::kBoolean;
+const DataType DataType::kUnsignedInteger;
+const DataType DataType::kInteger;
+const DataType DataType::kFloatingPoint;
+const DataType DataType::kTimeStamp;
+const DataType DataType::kErrorCode;
+const DataType DataType::kDuration;
+const DataType DataType::kString;
+
+} // namespace xentara::data
+
+namespace xentara::model
+{
+
+using namespace std::literals;
+
+const Attribute Attribute::kDeviceState { {}, "deviceState"sv, Access::ReadOnly, data::DataType::kBoolean };
+const Attribute Attribute::kUpdateTime { {}, "updateTime"sv, Access::ReadOnly, data::DataType::kTimeStamp };
+const Attribute Attribute::kChangeTime { {}, "changeTime"sv, Access::ReadOnly, data::DataType::kTimeStamp };
+const Attribute Attribute::kQuality { {}, "quality"sv, Access::ReadOnly, data::DataType::kInteger };
+const Attribute Attribute::kValue { {}, "value"sv, Access::ReadOnly, data::DataType::kFloatingPoint };
+const Attribute Attribute::kError { {}, "error"sv, Access::ReadOnly, data::DataType::kErrorCode };
+const Attribute Attribute::kWriteError { {}, "writeError"sv, Access::ReadOnly, data::DataType::kErrorCode };
+const Attribute Attribute::kWriteTime { {}, "writeTime"sv, Access::ReadOnly, data::DataType::kTimeStamp };
+
+} // namespace xentara::model
+
+namespace xentara::process
+{
+
+using namespace std::literals;
+
+const Event::Role Event::kConnected { {}, "connected"sv };
+const Event::Role Event::kDisconnected { {}, "disconnected"sv };
+const Event::Role Event::kChanged { {}, "changed"sv };
+
+const Task::Role Task::kReconnect { {}, "reconnect"sv };
+
+} // namespace xentara::process
\ No newline at end of file
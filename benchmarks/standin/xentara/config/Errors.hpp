@@ -0,0 +1,22 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace xentara::config
+{
+
+/// @brief Stand-in for the configuration context passed to load()
+class Context final
+{
+};
+
+/// @brief Stand-in that throws an error for an unknown configuration parameter
+[[noreturn]] inline auto throwUnknownParameterError(std::string_view name) -> void
+{
+	throw std::runtime_error("unknown parameter \"" + std::string(name) + "\"");
+}
+
+} // namespace xentara::config
\ No newline at end of file
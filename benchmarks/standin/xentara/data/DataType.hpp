@@ -0,0 +1,21 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::data
+{
+
+/// @brief Stand-in for the Xentara data type descriptors
+class DataType final
+{
+public:
+	static const DataType kBoolean;
+	static const DataType kUnsignedInteger;
+	static const DataType kInteger;
+	static const DataType kFloatingPoint;
+	static const DataType kTimeStamp;
+	static const DataType kErrorCode;
+	static const DataType kDuration;
+	static const DataType kString;
+};
+
+} // namespace xentara::data
\ No newline at end of file
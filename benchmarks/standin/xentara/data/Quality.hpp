@@ -0,0 +1,15 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::data
+{
+
+/// @brief Stand-in for the Xentara quality
+enum class Quality
+{
+	Good,
+	Acceptable,
+	Bad
+};
+
+} // namespace xentara::data
\ No newline at end of file
@@ -0,0 +1,32 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <any>
+#include <functional>
+
+namespace xentara::data
+{
+
+/// @brief Stand-in for a read handle
+class ReadHandle final
+{
+public:
+	/// @brief Creates a handle from a function that reads the current value
+	template <typename Value>
+	ReadHandle(std::function<Value()> read) : _read([read = std::move(read)]() { return std::any(read()); })
+	{
+	}
+
+	/// @brief Reads the current value
+	/// @throw std::bad_any_cast The attribute does not have the requested type
+	template <typename Value>
+	auto read() const -> Value
+	{
+		return std::any_cast<Value>(_read());
+	}
+
+private:
+	std::function<std::any()> _read;
+};
+
+} // namespace xentara::data
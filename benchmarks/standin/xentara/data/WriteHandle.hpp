@@ -0,0 +1,41 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+namespace xentara::data
+{
+
+/// @brief Stand-in for a write handle to a member function of an element
+class WriteHandle final
+{
+public:
+	/// @brief Creates a handle that calls a member function of an element for each value written
+	template <typename Value, typename Function, typename Element>
+	WriteHandle(std::in_place_type_t<Value>, Function function, std::weak_ptr<Element> element) :
+		_write([function, element = std::move(element)](const void *value) -> std::error_code {
+			const auto target = element.lock();
+			if (!target)
+			{
+				return std::make_error_code(std::errc::owner_dead);
+			}
+			return ((*target).*function)(*static_cast<const Value *>(value));
+		})
+	{
+	}
+
+	/// @brief Writes a value. The value must have the type the handle was created with.
+	template <typename Value>
+	auto write(const Value &value) const -> std::error_code
+	{
+		return _write(&value);
+	}
+
+private:
+	std::function<std::error_code(const void *)> _write;
+};
+
+} // namespace xentara::data
@@ -0,0 +1,35 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::io
+{
+
+/// @brief Stand-in for an I/O direction
+enum class Direction
+{
+	Input = 1,
+	Output = 2
+};
+
+/// @brief Stand-in for a set of I/O directions
+class Directions final
+{
+public:
+	constexpr Directions(Direction direction) noexcept : _bits(int(direction))
+	{
+	}
+
+	constexpr Directions(int bits) noexcept : _bits(bits)
+	{
+	}
+
+private:
+	int _bits;
+};
+
+constexpr auto operator|(Direction left, Direction right) noexcept -> Directions
+{
+	return int(left) | int(right);
+}
+
+} // namespace xentara::io
\ No newline at end of file
@@ -0,0 +1,2 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
\ No newline at end of file
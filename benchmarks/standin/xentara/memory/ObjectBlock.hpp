@@ -0,0 +1,54 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "memoryResources.hpp"
+
+#include <functional>
+#include <mutex>
+
+namespace xentara::memory
+{
+
+template <typename Object>
+class ReadSentinel;
+
+template <typename Object>
+class WriteSentinel;
+
+/// @brief Stand-in for a block of memory in a memory resource.
+///
+/// Writers are serialized, and every write copies the whole object in and out, just like the swap-in used by the real
+/// memory resources.
+template <typename Object>
+class ObjectBlock final
+{
+public:
+	/// @brief Creates the block. The stand-in keeps the object inline, so this does nothing.
+	auto create(MemoryResource &) -> void
+	{
+	}
+
+	/// @brief Gets a function that reads a member of the object, for use in read handles
+	template <typename Member>
+	auto member(Member Object::*member) const -> std::function<Member()>
+	{
+		return [this, member]() {
+			std::scoped_lock lock { _copyMutex };
+			return _object.*member;
+		};
+	}
+
+private:
+	friend class ReadSentinel<Object>;
+	friend class WriteSentinel<Object>;
+
+	/// @brief Held by a write sentinel for its whole lifetime
+	std::mutex _writeMutex;
+	/// @brief Held while the object is copied
+	mutable std::mutex _copyMutex;
+
+	/// @brief The object
+	Object _object {};
+};
+
+} // namespace xentara::memory
\ No newline at end of file
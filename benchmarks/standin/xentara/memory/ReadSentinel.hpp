@@ -0,0 +1,40 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ObjectBlock.hpp"
+
+#include <mutex>
+
+namespace xentara::memory
+{
+
+/// @brief Stand-in for a read sentinel. This takes a consistent copy of the object.
+template <typename Object>
+class ReadSentinel final
+{
+public:
+	ReadSentinel(const ObjectBlock<Object> &block) : _object(copy(block))
+	{
+	}
+
+	auto operator*() const noexcept -> const Object &
+	{
+		return _object;
+	}
+
+	auto operator->() const noexcept -> const Object *
+	{
+		return &_object;
+	}
+
+private:
+	static auto copy(const ObjectBlock<Object> &block) -> Object
+	{
+		std::scoped_lock lock { block._copyMutex };
+		return block._object;
+	}
+
+	Object _object;
+};
+
+} // namespace xentara::memory
\ No newline at end of file
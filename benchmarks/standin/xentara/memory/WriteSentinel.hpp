@@ -0,0 +1,78 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "ObjectBlock.hpp"
+
+#include <xentara/process/Event.hpp>
+#include <xentara/process/EventList.hpp>
+
+#include <chrono>
+#include <mutex>
+
+namespace xentara::memory
+{
+
+/// @brief Stand-in for a write sentinel.
+///
+/// The sentinel holds the write lock of the block for its whole lifetime, and works on a copy of the object that is
+/// copied back on commit. Events are counted, but not delivered anywhere.
+template <typename Object>
+class WriteSentinel final
+{
+public:
+	WriteSentinel(ObjectBlock<Object> &block) : _block(block), _lock(block._writeMutex), _newValue(copy(block))
+	{
+	}
+
+	auto operator*() noexcept -> Object &
+	{
+		return _newValue;
+	}
+
+	auto operator->() noexcept -> Object *
+	{
+		return &_newValue;
+	}
+
+	/// @brief Gets the value before the update. Only writers change the object, so this needs no copy.
+	auto oldValue() const noexcept -> const Object &
+	{
+		return _block._object;
+	}
+
+	auto commit(std::chrono::system_clock::time_point) -> void
+	{
+		store();
+	}
+
+	auto commit(std::chrono::system_clock::time_point, const process::Event &event) -> void
+	{
+		store();
+		event.raise();
+	}
+
+	auto commit(std::chrono::system_clock::time_point, const process::EventList &events) -> void
+	{
+		store();
+		events.raise();
+	}
+
+private:
+	static auto copy(const ObjectBlock<Object> &block) -> Object
+	{
+		std::scoped_lock lock { block._copyMutex };
+		return block._object;
+	}
+
+	auto store() -> void
+	{
+		std::scoped_lock lock { _block._copyMutex };
+		_block._object = _newValue;
+	}
+
+	ObjectBlock<Object> &_block;
+	std::scoped_lock<std::mutex> _lock;
+	Object _newValue;
+};
+
+} // namespace xentara::memory
\ No newline at end of file
@@ -0,0 +1,24 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::memory
+{
+
+/// @brief Stand-in for a memory resource. Blocks are allocated on the heap instead.
+class MemoryResource final
+{
+};
+
+namespace memoryResources
+{
+
+/// @brief Gets the stand-in for the data memory resource
+inline auto data() -> MemoryResource &
+{
+	static MemoryResource resource;
+	return resource;
+}
+
+} // namespace memoryResources
+
+} // namespace xentara::memory
\ No newline at end of file
@@ -0,0 +1,59 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Role.hpp"
+
+#include <xentara/data/DataType.hpp>
+
+#include <string_view>
+
+namespace xentara::model
+{
+
+/// @brief Stand-in for a Xentara attribute
+class Attribute final : public Role
+{
+public:
+	enum class Access
+	{
+		ReadOnly,
+		WriteOnly,
+		ReadWrite
+	};
+
+	constexpr Attribute(utils::core::Uuid uuid, std::string_view name, Access access, const data::DataType &dataType) noexcept :
+		Role(uuid, name), _access(access), _dataType(&dataType)
+	{
+	}
+
+	constexpr Attribute(const Attribute &base, Access access, const data::DataType &dataType) noexcept :
+		Role(base), _access(access), _dataType(&dataType)
+	{
+	}
+
+	auto dataType() const noexcept -> const data::DataType &
+	{
+		return *_dataType;
+	}
+
+	/// @brief Attributes are compared by identity, which is how the driver uses them
+	auto operator==(const Attribute &other) const noexcept -> bool
+	{
+		return this == &other;
+	}
+
+	static const Attribute kDeviceState;
+	static const Attribute kUpdateTime;
+	static const Attribute kChangeTime;
+	static const Attribute kQuality;
+	static const Attribute kValue;
+	static const Attribute kError;
+	static const Attribute kWriteError;
+	static const Attribute kWriteTime;
+
+private:
+	Access _access;
+	const data::DataType *_dataType;
+};
+
+} // namespace xentara::model
\ No newline at end of file
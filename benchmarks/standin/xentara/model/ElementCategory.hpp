@@ -0,0 +1,14 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::model
+{
+
+/// @brief Stand-in for the category of an element
+enum class ElementCategory
+{
+	Device,
+	DataPoint
+};
+
+} // namespace xentara::model
\ No newline at end of file
@@ -0,0 +1,13 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Attribute.hpp"
+
+#include <functional>
+
+namespace xentara::model
+{
+
+using ForEachAttributeFunction = std::function<bool(const Attribute &)>;
+
+} // namespace xentara::model
\ No newline at end of file
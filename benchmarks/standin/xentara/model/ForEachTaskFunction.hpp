@@ -0,0 +1,16 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Role.hpp"
+
+#include <xentara/process/Task.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace xentara::model
+{
+
+using ForEachTaskFunction = std::function<bool(const Role &, std::shared_ptr<process::Task>)>;
+
+} // namespace xentara::model
\ No newline at end of file
@@ -0,0 +1,29 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/utils/core/Uuid.hpp>
+
+#include <string_view>
+
+namespace xentara::model
+{
+
+/// @brief Stand-in for the role of an attribute, event, or task
+class Role
+{
+public:
+	constexpr Role(utils::core::Uuid uuid, std::string_view name) noexcept : _uuid(uuid), _name(name)
+	{
+	}
+
+	constexpr auto name() const noexcept -> std::string_view
+	{
+		return _name;
+	}
+
+private:
+	utils::core::Uuid _uuid;
+	std::string_view _name;
+};
+
+} // namespace xentara::model
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/io/Direction.hpp>
+#include <xentara/model/Role.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace xentara::process
+{
+
+/// @brief Stand-in for an event. Raising the event only counts it.
+class Event final
+{
+public:
+	using Role = model::Role;
+
+	Event() = default;
+
+	Event(io::Direction)
+	{
+	}
+
+	/// @brief Raises the event
+	auto raise() const noexcept -> void
+	{
+		_raised.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// @brief Gets the number of times the event was raised
+	auto raised() const noexcept -> std::uint64_t
+	{
+		return _raised.load(std::memory_order_relaxed);
+	}
+
+	static const Role kConnected;
+	static const Role kDisconnected;
+	static const Role kChanged;
+
+private:
+	mutable std::atomic<std::uint64_t> _raised { 0 };
+};
+
+} // namespace xentara::process
\ No newline at end of file
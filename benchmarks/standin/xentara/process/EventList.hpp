@@ -0,0 +1,88 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Event.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace xentara::process
+{
+
+/// @brief Stand-in for a list of events that are raised together
+class EventList
+{
+public:
+	virtual ~EventList() = default;
+
+	/// @brief Raises all the events in the list
+	virtual auto raise() const noexcept -> void = 0;
+};
+
+/// @brief Stand-in for an event list with a fixed capacity
+template <std::size_t kCapacity>
+class StaticEventList final : public EventList
+{
+public:
+	auto push_back(const Event &event) noexcept -> void
+	{
+		_events[_size++] = &event;
+	}
+
+	auto raise() const noexcept -> void final
+	{
+		for (std::size_t index = 0; index < _size; ++index)
+		{
+			_events[index]->raise();
+		}
+	}
+
+private:
+	std::array<const Event *, kCapacity> _events {};
+	std::size_t _size { 0 };
+};
+
+/// @brief Stand-in for an event list that grows as needed
+class DynamicEventList final : public EventList
+{
+public:
+	auto push_back(const Event &event) -> void
+	{
+		_events.push_back(event);
+	}
+
+	auto reserve(std::size_t capacity) -> void
+	{
+		_events.reserve(capacity);
+	}
+
+	auto clear() noexcept -> void
+	{
+		_events.clear();
+	}
+
+	auto empty() const noexcept -> bool
+	{
+		return _events.empty();
+	}
+
+	auto size() const noexcept -> std::size_t
+	{
+		return _events.size();
+	}
+
+	auto raise() const noexcept -> void final
+	{
+		for (auto &&event : _events)
+		{
+			event.get().raise();
+		}
+	}
+
+private:
+	std::vector<std::reference_wrapper<const Event>> _events;
+};
+
+} // namespace xentara::process
\ No newline at end of file
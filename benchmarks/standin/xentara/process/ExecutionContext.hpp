@@ -0,0 +1,26 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <chrono>
+
+namespace xentara::process
+{
+
+/// @brief Stand-in for the context a task is executed in
+class ExecutionContext final
+{
+public:
+	explicit ExecutionContext(std::chrono::system_clock::time_point scheduledTime) noexcept : _scheduledTime(scheduledTime)
+	{
+	}
+
+	auto scheduledTime() const noexcept -> std::chrono::system_clock::time_point
+	{
+		return _scheduledTime;
+	}
+
+private:
+	std::chrono::system_clock::time_point _scheduledTime;
+};
+
+} // namespace xentara::process
\ No newline at end of file
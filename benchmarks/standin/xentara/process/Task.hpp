@@ -0,0 +1,88 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/model/Role.hpp>
+
+namespace xentara::process
+{
+
+class ExecutionContext;
+
+/// @brief Stand-in for the interface of a Xentara task
+class Task
+{
+public:
+	using Role = model::Role;
+
+	enum class Stage
+	{
+		PreOperational = 1,
+		Operational = 2,
+		PostOperational = 4
+	};
+
+	class Stages final
+	{
+	public:
+		constexpr Stages(Stage stage) noexcept : _bits(int(stage))
+		{
+		}
+
+		constexpr Stages(int bits) noexcept : _bits(bits)
+		{
+		}
+
+		friend constexpr auto operator|(Stages left, Stage right) noexcept -> Stages
+		{
+			return left._bits | int(right);
+		}
+
+	private:
+		int _bits;
+	};
+
+	enum class Status
+	{
+		Ready,
+		Pending
+	};
+
+	virtual ~Task() = default;
+
+	virtual auto stages() const -> Stages = 0;
+
+	virtual auto preparePreOperational(const ExecutionContext &) -> Status
+	{
+		return Status::Ready;
+	}
+
+	virtual auto preOperational(const ExecutionContext &) -> Status
+	{
+		return Status::Ready;
+	}
+
+	virtual auto operational(const ExecutionContext &) -> void = 0;
+
+	virtual auto preparePostOperational(const ExecutionContext &) -> Status
+	{
+		return Status::Ready;
+	}
+
+	virtual auto postOperational(const ExecutionContext &) -> Status
+	{
+		return Status::Ready;
+	}
+
+	virtual auto finishPostOperational(const ExecutionContext &) -> void
+	{
+	}
+
+	static const Role kReconnect;
+};
+
+constexpr auto operator|(Task::Stage left, Task::Stage right) noexcept -> Task::Stages
+{
+	return Task::Stages(left) | right;
+}
+
+} // namespace xentara::process
\ No newline at end of file
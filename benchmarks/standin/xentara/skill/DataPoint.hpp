@@ -0,0 +1,21 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Element.hpp"
+
+#include <xentara/data/DataType.hpp>
+#include <xentara/io/Direction.hpp>
+
+namespace xentara::skill
+{
+
+/// @brief Stand-in for the base class of data points
+class DataPoint : public Element
+{
+public:
+	virtual auto dataType() const -> const data::DataType & = 0;
+
+	virtual auto directions() const -> io::Directions = 0;
+};
+
+} // namespace xentara::skill
\ No newline at end of file
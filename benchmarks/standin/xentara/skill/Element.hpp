@@ -0,0 +1,103 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/config/Errors.hpp>
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/data/WriteHandle.hpp>
+#include <xentara/model/Attribute.hpp>
+#include <xentara/model/ElementCategory.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+#include <xentara/model/ForEachEventFunction.hpp>
+#include <xentara/model/ForEachTaskFunction.hpp>
+#include <xentara/utils/core/Uuid.hpp>
+#include <xentara/utils/json/decoder/Object.hpp>
+
+#include <memory>
+#include <optional>
+
+namespace xentara::standin
+{
+
+class Runtime;
+
+} // namespace xentara::standin
+
+namespace xentara::skill
+{
+
+class ElementFactory;
+
+/// @brief Stand-in for the base class of all skill elements
+class Element
+{
+public:
+	/// @brief Stand-in for the meta-information about an element type
+	class Class
+	{
+	public:
+		virtual ~Class() = default;
+	};
+
+	/// @brief Stand-in for the class object of a concrete element type
+	template <utils::core::FixedString kName, utils::core::Uuid kUuid, utils::core::FixedString kDisplayName>
+	class ConcreteClass final : public Class
+	{
+	public:
+		static auto instance() -> ConcreteClass &
+		{
+			static ConcreteClass instance;
+			return instance;
+		}
+	};
+
+	virtual ~Element() = default;
+
+	virtual auto createChildElement(const Class &, ElementFactory &) -> std::shared_ptr<Element>
+	{
+		return nullptr;
+	}
+
+	virtual auto forEachAttribute(const model::ForEachAttributeFunction &) const -> bool
+	{
+		return false;
+	}
+
+	virtual auto forEachEvent(const model::ForEachEventFunction &) -> bool
+	{
+		return false;
+	}
+
+	virtual auto forEachTask(const model::ForEachTaskFunction &) -> bool
+	{
+		return false;
+	}
+
+	virtual auto makeReadHandle(const model::Attribute &) const noexcept -> std::optional<data::ReadHandle>
+	{
+		return std::nullopt;
+	}
+
+	virtual auto makeWriteHandle(const model::Attribute &) noexcept -> std::optional<data::WriteHandle>
+	{
+		return std::nullopt;
+	}
+
+	virtual auto category() const noexcept -> model::ElementCategory
+	{
+		return model::ElementCategory::DataPoint;
+	}
+
+protected:
+	// The stand-in runtime loads and realizes the elements
+	friend class standin::Runtime;
+
+	virtual auto load(utils::json::decoder::Object &, config::Context &) -> void
+	{
+	}
+
+	virtual auto realize() -> void
+	{
+	}
+};
+
+} // namespace xentara::skill
\ No newline at end of file
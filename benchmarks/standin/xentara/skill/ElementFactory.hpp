@@ -0,0 +1,21 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <memory>
+#include <utility>
+
+namespace xentara::skill
+{
+
+/// @brief Stand-in for the factory used to create elements
+class ElementFactory final
+{
+public:
+	template <typename Element, typename... Arguments>
+	auto makeShared(Arguments &&...arguments) -> std::shared_ptr<Element>
+	{
+		return std::make_shared<Element>(std::forward<Arguments>(arguments)...);
+	}
+};
+
+} // namespace xentara::skill
\ No newline at end of file
@@ -0,0 +1,31 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <memory>
+
+namespace xentara::skill
+{
+
+/// @brief Stand-in for the shared-from-this helper of skill elements
+template <typename Derived>
+class EnableSharedFromThis : public std::enable_shared_from_this<Derived>
+{
+public:
+	auto sharedFromThis() -> std::shared_ptr<Derived>
+	{
+		return this->shared_from_this();
+	}
+
+	template <typename Member>
+	auto sharedFromThis(Member *member) -> std::shared_ptr<Member>
+	{
+		return std::shared_ptr<Member>(this->shared_from_this(), member);
+	}
+
+	auto weakFromThis() -> std::weak_ptr<Derived>
+	{
+		return this->weak_from_this();
+	}
+};
+
+} // namespace xentara::skill
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/config/Errors.hpp>
+#include <xentara/process/ExecutionContext.hpp>
+#include <xentara/process/Task.hpp>
+#include <xentara/skill/Element.hpp>
+#include <xentara/utils/json/decoder/Object.hpp>
+
+#include <chrono>
+#include <thread>
+
+namespace xentara::standin
+{
+
+/// @brief Stand-in for the parts of the Xentara runtime that drive the life cycle of elements and tasks.
+///
+/// This is not part of the Xentara libraries. It exists so that tools built against the stand-in can load, realize,
+/// and run elements the way Xentara would.
+class Runtime final
+{
+public:
+	/// @brief Loads the configuration of an element
+	static auto load(skill::Element &element, utils::json::decoder::Object &jsonObject) -> void
+	{
+		config::Context context;
+		element.load(jsonObject, context);
+	}
+
+	/// @brief Realizes an element
+	static auto realize(skill::Element &element) -> void
+	{
+		element.realize();
+	}
+
+	/// @brief Runs the pre-operational stage of a task until it is ready
+	static auto preOperational(process::Task &task) -> void
+	{
+		runUntilReady(task, &process::Task::preparePreOperational);
+		runUntilReady(task, &process::Task::preOperational);
+	}
+
+	/// @brief Runs the post-operational stage of a task until it is ready
+	static auto postOperational(process::Task &task) -> void
+	{
+		runUntilReady(task, &process::Task::preparePostOperational);
+		runUntilReady(task, &process::Task::postOperational);
+		task.finishPostOperational(process::ExecutionContext(std::chrono::system_clock::now()));
+	}
+
+private:
+	/// @brief Calls a stage function repeatedly until it returns process::Task::Status::Ready
+	static auto runUntilReady(process::Task &task,
+		process::Task::Status (process::Task::*stage)(const process::ExecutionContext &)) -> void
+	{
+		using namespace std::literals;
+
+		while ((task.*stage)(process::ExecutionContext(std::chrono::system_clock::now())) != process::Task::Status::Ready)
+		{
+			std::this_thread::sleep_for(1ms);
+		}
+	}
+};
+
+} // namespace xentara::standin
\ No newline at end of file
@@ -0,0 +1,64 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <atomic>
+#include <optional>
+
+namespace xentara::utils::atomic
+{
+
+/// @brief Stand-in for an atomic optional value, stored as a value and a flag in a single atomic
+template <typename Value>
+class Optional final
+{
+	struct Representation final
+	{
+		Value _value {};
+		bool _hasValue { false };
+	};
+
+public:
+	static constexpr bool is_always_lock_free = std::atomic<Representation>::is_always_lock_free;
+
+	auto store(const std::optional<Value> &value, std::memory_order order = std::memory_order_seq_cst) noexcept -> void
+	{
+		_representation.store(represent(value), order);
+	}
+
+	auto exchange(const std::optional<Value> &value, std::memory_order order = std::memory_order_seq_cst) noexcept
+		-> std::optional<Value>
+	{
+		return unrepresent(_representation.exchange(represent(value), order));
+	}
+
+	auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> std::optional<Value>
+	{
+		return unrepresent(_representation.load(order));
+	}
+
+	auto compare_exchange_strong(std::optional<Value> &expected,
+		const std::optional<Value> &desired,
+		std::memory_order success = std::memory_order_seq_cst,
+		std::memory_order failure = std::memory_order_seq_cst) noexcept -> bool
+	{
+		auto representation = represent(expected);
+		const auto exchanged = _representation.compare_exchange_strong(representation, represent(desired), success, failure);
+		expected = unrepresent(representation);
+		return exchanged;
+	}
+
+private:
+	static auto represent(const std::optional<Value> &value) noexcept -> Representation
+	{
+		return value ? Representation { *value, true } : Representation {};
+	}
+
+	static auto unrepresent(const Representation &representation) noexcept -> std::optional<Value>
+	{
+		return representation._hasValue ? std::optional<Value>(representation._value) : std::nullopt;
+	}
+
+	std::atomic<Representation> _representation {};
+};
+
+} // namespace xentara::utils::atomic
\ No newline at end of file
@@ -0,0 +1,82 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+
+namespace xentara::utils::core
+{
+
+/// @brief Stand-in for a UUID
+struct Uuid final
+{
+	std::array<std::uint8_t, 16> _bytes {};
+
+	constexpr auto operator<=>(const Uuid &) const noexcept = default;
+};
+
+/// @brief Stand-in for a string that can be used as a template argument
+template <std::size_t kSize>
+struct FixedString final
+{
+	constexpr FixedString(const char (&string)[kSize]) noexcept
+	{
+		for (std::size_t index = 0; index < kSize; ++index)
+		{
+			_data[index] = string[index];
+		}
+	}
+
+	char _data[kSize] {};
+};
+
+/// @brief Parses the hexadecimal digits of a UUID, ignoring the dashes
+constexpr auto parseUuid(const char *string, std::size_t size) noexcept -> Uuid
+{
+	Uuid uuid;
+	std::size_t digits = 0;
+	for (std::size_t index = 0; index < size && digits < 32; ++index)
+	{
+		const auto character = string[index];
+		int nibble = -1;
+		if (character >= '0' && character <= '9')
+		{
+			nibble = character - '0';
+		}
+		else if (character >= 'a' && character <= 'f')
+		{
+			nibble = character - 'a' + 10;
+		}
+		else if (character >= 'A' && character <= 'F')
+		{
+			nibble = character - 'A' + 10;
+		}
+		if (nibble < 0)
+		{
+			continue;
+		}
+
+		uuid._bytes[digits / 2] |= std::uint8_t(digits % 2 == 0 ? nibble << 4 : nibble);
+		++digits;
+	}
+	return uuid;
+}
+
+} // namespace xentara::utils::core
+
+namespace xentara
+{
+
+inline namespace literals
+{
+
+constexpr auto operator""_uuid(const char *string, std::size_t size) noexcept -> utils::core::Uuid
+{
+	return utils::core::parseUuid(string, size);
+}
+
+} // namespace literals
+
+} // namespace xentara
\ No newline at end of file
@@ -0,0 +1,27 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <exception>
+#include <system_error>
+
+namespace xentara::utils::eh
+{
+
+/// @brief Stand-in that gets the error code from the current exception
+inline auto currentErrorCode() noexcept -> std::error_code
+{
+	try
+	{
+		throw;
+	}
+	catch (const std::system_error &exception)
+	{
+		return exception.code();
+	}
+	catch (...)
+	{
+		return std::make_error_code(std::errc::io_error);
+	}
+}
+
+} // namespace xentara::utils::eh
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <utility>
+#include <variant>
+
+namespace xentara::utils::eh
+{
+
+/// @brief Stand-in for an unexpected error value
+template <typename Error>
+struct Unexpected final
+{
+	Error _error;
+};
+
+template <typename Error>
+auto unexpected(Error error) -> Unexpected<Error>
+{
+	return { std::move(error) };
+}
+
+/// @brief Stand-in for a type that holds either a value or an error
+template <typename Value, typename Error>
+class expected final
+{
+public:
+	expected(const Value &value) : _storage(std::in_place_index<0>, value)
+	{
+	}
+
+	template <typename OtherError>
+	expected(Unexpected<OtherError> error) : _storage(std::in_place_index<1>, Error(std::move(error._error)))
+	{
+	}
+
+	explicit operator bool() const noexcept
+	{
+		return has_value();
+	}
+
+	auto has_value() const noexcept -> bool
+	{
+		return _storage.index() == 0;
+	}
+
+	auto operator*() const -> const Value &
+	{
+		return *std::get_if<0>(&_storage);
+	}
+
+	auto value() const -> const Value &
+	{
+		return std::get<0>(_storage);
+	}
+
+	auto error() const -> const Error &
+	{
+		return *std::get_if<1>(&_storage);
+	}
+
+private:
+	std::variant<Value, Error> _storage;
+};
+
+} // namespace xentara::utils::eh
\ No newline at end of file
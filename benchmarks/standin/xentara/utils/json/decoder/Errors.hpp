@@ -0,0 +1,23 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "Object.hpp"
+
+namespace xentara::utils::json::decoder
+{
+
+/// @brief Stand-in that throws an error without location information
+template <typename Exception>
+[[noreturn]] auto throwWithLocation(const Value &, Exception exception) -> void
+{
+	throw exception;
+}
+
+/// @brief Stand-in that throws an error without location information
+template <typename Exception>
+[[noreturn]] auto throwWithLocation(const Object &, Exception exception) -> void
+{
+	throw exception;
+}
+
+} // namespace xentara::utils::json::decoder
\ No newline at end of file
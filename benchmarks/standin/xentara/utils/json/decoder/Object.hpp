@@ -0,0 +1,92 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace xentara::utils::json::decoder
+{
+
+/// @brief Stand-in for a JSON value. The value is kept as text, and converted when it is asked for.
+class Value final
+{
+public:
+	Value() = default;
+
+	explicit Value(std::string text) : _text(std::move(text))
+	{
+	}
+
+	template <typename Number>
+	auto asNumber() const -> Number
+	{
+		Number number {};
+		const auto end = _text.data() + _text.size();
+		const auto [last, error] = std::from_chars(_text.data(), end, number);
+		if (error != std::errc() || last != end)
+		{
+			throw std::runtime_error("\"" + _text + "\" is not a valid number");
+		}
+		return number;
+	}
+
+	auto asBool() const -> bool
+	{
+		if (_text == "true")
+		{
+			return true;
+		}
+		else if (_text == "false")
+		{
+			return false;
+		}
+
+		throw std::runtime_error("\"" + _text + "\" is not a valid Boolean value");
+	}
+
+	template <typename String = std::string>
+	auto asString() const -> String
+	{
+		return String(_text);
+	}
+
+private:
+	std::string _text;
+};
+
+/// @brief Stand-in for a member of a JSON object
+struct Member final
+{
+	std::string first;
+	Value second;
+};
+
+/// @brief Stand-in for a JSON object, holding its members in order
+class Object final
+{
+public:
+	/// @brief Adds a member
+	auto add(std::string name, std::string text) -> void
+	{
+		_members.push_back({ std::move(name), Value(std::move(text)) });
+	}
+
+	auto begin() noexcept
+	{
+		return _members.begin();
+	}
+
+	auto end() noexcept
+	{
+		return _members.end();
+	}
+
+private:
+	std::vector<Member> _members;
+};
+
+} // namespace xentara::utils::json::decoder
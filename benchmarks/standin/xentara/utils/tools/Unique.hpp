@@ -0,0 +1,18 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+namespace xentara::utils::tools
+{
+
+/// @brief Stand-in for a base class that makes a class movable, but not copyable
+class Unique
+{
+public:
+	Unique() = default;
+	Unique(Unique &&) = default;
+	auto operator=(Unique &&) -> Unique & = default;
+	Unique(const Unique &) = delete;
+	auto operator=(const Unique &) -> Unique & = delete;
+};
+
+} // namespace xentara::utils::tools
\ No newline at end of file
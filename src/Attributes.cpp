@@ -15,10 +15,142 @@ const model::Attribute kError { model::Attribute::kError, model::Attribute::Acce
 
 const model::Attribute kWriteError { model::Attribute::kWriteError, model::Attribute::Access::ReadOnly, data::DataType::kErrorCode };
 
+/// @todo assign a unique UUID
+const model::Attribute kWriteQueueDepth { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeQueueDepth"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteSuppressed { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeSuppressed"sv, model::Attribute::Access::ReadOnly, data::DataType::kBoolean };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteDerived { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeDerived"sv, model::Attribute::Access::ReadOnly, data::DataType::kBoolean };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteLatencyP50 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeLatencyP50"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteLatencyP99 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeLatencyP99"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteLatencyMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeLatencyMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kDeviceWriteLatencyP50 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "deviceWriteLatencyP50"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kDeviceWriteLatencyP99 { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "deviceWriteLatencyP99"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kDeviceWriteLatencyMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "deviceWriteLatencyMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
 /// @todo assign a unique UUID
 const model::Attribute kConnectionTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "connectionTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kTimeStamp };
 
 /// @todo assign a unique UUID
 const model::Attribute kDeviceError { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "error"sv, model::Attribute::Access::ReadOnly, data::DataType::kErrorCode };
 
+/// @todo assign a unique UUID
+const model::Attribute kReconnectAttempts { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectAttempts"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kNextReconnectTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "nextReconnectTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kTimeStamp };
+
+/// @todo assign a unique UUID
+const model::Attribute kReconnectQueueDepth { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectQueueDepth"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kReconnectWaitTime { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectWaitTime"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kThrottledWrites { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "throttledWrites"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadsPerSecond { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readsPerSecond"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kWritesPerSecond { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writesPerSecond"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kTimeoutErrors { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "timeoutErrors"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kConnectionErrors { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "connectionErrors"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kRequestErrors { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "requestErrors"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kRoundTripMin { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "roundTripMin"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kRoundTripAverage { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "roundTripAverage"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kRoundTripMax { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "roundTripMax"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchFillRatio { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchFillRatio"sv, model::Attribute::Access::ReadOnly, data::DataType::kFloatingPoint };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kReadTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kWriteTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kReconnectTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kReconnectTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kReconnectTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchReadTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchReadTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchReadTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchReadTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchReadTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchReadTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchWriteTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchWriteTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchWriteTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchWriteTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kBatchWriteTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchWriteTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kFlushTraceTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "flushTraceTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kFlushTraceTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "flushTraceTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kFlushTraceTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "flushTraceTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kPublishStatisticsTaskOverruns { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "publishStatisticsTaskOverruns"sv, model::Attribute::Access::ReadOnly, data::DataType::kUnsignedInteger };
+
+/// @todo assign a unique UUID
+const model::Attribute kPublishStatisticsTaskMaxLateness { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "publishStatisticsTaskMaxLateness"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
+/// @todo assign a unique UUID
+const model::Attribute kPublishStatisticsTaskMaxDuration { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "publishStatisticsTaskMaxDuration"sv, model::Attribute::Access::ReadOnly, data::DataType::kDuration };
+
 } // namespace xentara::plugins::templateDriver::attributes
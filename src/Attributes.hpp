@@ -12,10 +12,100 @@ namespace xentara::plugins::templateDriver::attributes
 extern const model::Attribute kError;
 /// @brief A Xentara attribute containing a write error code for a data point
 extern const model::Attribute kWriteError;
+/// @brief A Xentara attribute containing the number of values that were in the write queue of a data point when it was last written
+extern const model::Attribute kWriteQueueDepth;
+/// @brief A Xentara attribute that tells whether the last write of a data point was skipped because the value had already been written
+extern const model::Attribute kWriteSuppressed;
+/// @brief A Xentara attribute that tells whether the current value of a data point was taken from a write rather than read from the device
+extern const model::Attribute kWriteDerived;
+/// @brief A Xentara attribute containing the median time from scheduling a value to committing the result of writing it
+extern const model::Attribute kWriteLatencyP50;
+/// @brief A Xentara attribute containing the 99th percentile of the time from scheduling a value to committing the result of writing it
+extern const model::Attribute kWriteLatencyP99;
+/// @brief A Xentara attribute containing the longest time from scheduling a value to committing the result of writing it
+extern const model::Attribute kWriteLatencyMax;
+/// @brief A Xentara attribute containing the median time the device took to acknowledge a write
+extern const model::Attribute kDeviceWriteLatencyP50;
+/// @brief A Xentara attribute containing the 99th percentile of the time the device took to acknowledge a write
+extern const model::Attribute kDeviceWriteLatencyP99;
+/// @brief A Xentara attribute containing the longest time the device took to acknowledge a write
+extern const model::Attribute kDeviceWriteLatencyMax;
 
 /// @brief A Xentara attribute containing the connection time for an I/O component
 extern const model::Attribute kConnectionTime;
 /// @brief A Xentara attribute containing an error code for an I/O component
 extern const model::Attribute kDeviceError;
+/// @brief A Xentara attribute containing the number of failed reconnect attempts since an I/O component was last connected
+extern const model::Attribute kReconnectAttempts;
+/// @brief A Xentara attribute containing the earliest time the next reconnect of an I/O component will be attempted
+extern const model::Attribute kNextReconnectTime;
+/// @brief A Xentara attribute containing the number of I/O components that were still waiting to connect when an I/O component
+/// was last allowed to connect
+extern const model::Attribute kReconnectQueueDepth;
+/// @brief A Xentara attribute containing how long an I/O component last had to wait before it was allowed to connect
+extern const model::Attribute kReconnectWaitTime;
+/// @brief A Xentara attribute containing the number of writes to an I/O component that were deferred by its write rate limit
+extern const model::Attribute kThrottledWrites;
+/// @brief A Xentara attribute containing the number of successful read requests per second sent by an I/O component
+extern const model::Attribute kReadsPerSecond;
+/// @brief A Xentara attribute containing the number of successful write requests per second sent by an I/O component
+extern const model::Attribute kWritesPerSecond;
+/// @brief A Xentara attribute containing the total number of timeouts of an I/O component
+extern const model::Attribute kTimeoutErrors;
+/// @brief A Xentara attribute containing the total number of connection errors of an I/O component
+extern const model::Attribute kConnectionErrors;
+/// @brief A Xentara attribute containing the total number of errors of an I/O component that only affected a single request
+extern const model::Attribute kRequestErrors;
+/// @brief A Xentara attribute containing the shortest recent round trip time of the requests of an I/O component
+extern const model::Attribute kRoundTripMin;
+/// @brief A Xentara attribute containing the average recent round trip time of the requests of an I/O component
+extern const model::Attribute kRoundTripAverage;
+/// @brief A Xentara attribute containing the longest recent round trip time of the requests of an I/O component
+extern const model::Attribute kRoundTripMax;
+/// @brief A Xentara attribute containing the fraction of the addresses in recent block requests of an I/O component that belong to a data point
+extern const model::Attribute kBatchFillRatio;
+
+/// @brief A Xentara attribute containing the number of times the "read" task of a data point took longer than its period
+extern const model::Attribute kReadTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "read" task of a data point started
+extern const model::Attribute kReadTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "read" task of a data point took
+extern const model::Attribute kReadTaskMaxDuration;
+/// @brief A Xentara attribute containing the number of times the "write" task of a data point took longer than its period
+extern const model::Attribute kWriteTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "write" task of a data point started
+extern const model::Attribute kWriteTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "write" task of a data point took
+extern const model::Attribute kWriteTaskMaxDuration;
+/// @brief A Xentara attribute containing the number of times the "reconnect" task of an I/O component took longer than its period
+extern const model::Attribute kReconnectTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "reconnect" task of an I/O component started
+extern const model::Attribute kReconnectTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "reconnect" task of an I/O component took
+extern const model::Attribute kReconnectTaskMaxDuration;
+/// @brief A Xentara attribute containing the number of times the "batchRead" task of an I/O component took longer than its period
+extern const model::Attribute kBatchReadTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "batchRead" task of an I/O component started
+extern const model::Attribute kBatchReadTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "batchRead" task of an I/O component took
+extern const model::Attribute kBatchReadTaskMaxDuration;
+/// @brief A Xentara attribute containing the number of times the "batchWrite" task of an I/O component took longer than its period
+extern const model::Attribute kBatchWriteTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "batchWrite" task of an I/O component started
+extern const model::Attribute kBatchWriteTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "batchWrite" task of an I/O component took
+extern const model::Attribute kBatchWriteTaskMaxDuration;
+/// @brief A Xentara attribute containing the number of times the "flushTrace" task of an I/O component took longer than its period
+extern const model::Attribute kFlushTraceTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "flushTrace" task of an I/O component started
+extern const model::Attribute kFlushTraceTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "flushTrace" task of an I/O component took
+extern const model::Attribute kFlushTraceTaskMaxDuration;
+/// @brief A Xentara attribute containing the number of times the "publishStatistics" task of an I/O component took longer than its period
+extern const model::Attribute kPublishStatisticsTaskOverruns;
+/// @brief A Xentara attribute containing the largest delay with which the "publishStatistics" task of an I/O component started
+extern const model::Attribute kPublishStatisticsTaskMaxLateness;
+/// @brief A Xentara attribute containing the longest time the "publishStatistics" task of an I/O component took
+extern const model::Attribute kPublishStatisticsTaskMaxDuration;
 
 } // namespace xentara::plugins::templateDriver::attributes
\ No newline at end of file
@@ -0,0 +1,149 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A thread-safe, lock-free first-in-first-out queue with a fixed capacity.
+///
+/// Any number of threads may enqueue and dequeue values at the same time. All memory is allocated by the constructor,
+/// so enqueuing and dequeuing never allocates.
+///
+/// The implementation uses a ring buffer of cells with sequence numbers, as described by Dmitry Vyukov.
+template <typename DataType>
+	requires std::is_default_constructible_v<DataType> && std::is_nothrow_move_assignable_v<DataType>
+class BoundedQueue final
+{
+public:
+	/// @brief Constructor
+	/// @param capacity The minimum number of values the queue must be able to hold. This is rounded up to a power of two.
+	explicit BoundedQueue(std::size_t capacity) :
+		_cells(std::make_unique<Cell[]>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))),
+		_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+	{
+		// Each cell starts out with a sequence number equal to its index, which marks it as free for the first lap
+		for (std::size_t index = 0; index <= _mask; ++index)
+		{
+			_cells[index]._sequence.store(index, std::memory_order_relaxed);
+		}
+	}
+
+	/// @brief Attempts to enqueue a value.
+	/// @param value The value to place in the queue
+	/// @return true if the value was enqueued, or false if the queue was full
+	auto tryEnqueue(DataType value) noexcept -> bool
+	{
+		auto position = _enqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			auto &cell = _cells[position & _mask];
+			const auto sequence = cell._sequence.load(std::memory_order_acquire);
+			const auto difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position);
+
+			// The cell is free, so try to claim it
+			if (difference == 0)
+			{
+				if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell._value = std::move(value);
+					cell._sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			// The cell still contains a value from the last lap, so the queue is full
+			else if (difference < 0)
+			{
+				return false;
+			}
+			// Another thread has claimed the cell, so try again with the new position
+			else
+			{
+				position = _enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// @brief Attempts to dequeue a value.
+	/// @return The oldest value in the queue, or std::nullopt if the queue was empty
+	auto tryDequeue() noexcept -> std::optional<DataType>
+	{
+		auto position = _dequeuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			auto &cell = _cells[position & _mask];
+			const auto sequence = cell._sequence.load(std::memory_order_acquire);
+			const auto difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position + 1);
+
+			// The cell contains a value, so try to claim it
+			if (difference == 0)
+			{
+				if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					auto value = std::exchange(cell._value, DataType {});
+					// Mark the cell as free for the next lap
+					cell._sequence.store(position + _mask + 1, std::memory_order_release);
+					return value;
+				}
+			}
+			// The cell has not been filled yet, so the queue is empty
+			else if (difference < 0)
+			{
+				return std::nullopt;
+			}
+			// Another thread has claimed the cell, so try again with the new position
+			else
+			{
+				position = _dequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// @brief Gets the number of values the queue can hold
+	auto capacity() const noexcept -> std::size_t
+	{
+		return _mask + 1;
+	}
+
+	/// @brief Gets the number of values in the queue.
+	/// @note The result is only a snapshot if other threads are using the queue at the same time.
+	auto size() const noexcept -> std::size_t
+	{
+		const auto dequeuePosition = _dequeuePosition.load(std::memory_order_relaxed);
+		const auto enqueuePosition = _enqueuePosition.load(std::memory_order_relaxed);
+		return enqueuePosition > dequeuePosition ? std::min(enqueuePosition - dequeuePosition, capacity()) : 0;
+	}
+
+private:
+	/// @brief A single cell of the ring buffer
+	struct Cell final
+	{
+		/// @brief The sequence number, which tells whether the cell is free or contains a value
+		std::atomic<std::size_t> _sequence { 0 };
+		/// @brief The value
+		DataType _value {};
+	};
+
+	/// @brief The size of a cache line, used to keep the positions from sharing one
+	static constexpr std::size_t kCacheLineSize = 64;
+
+	/// @brief The ring buffer
+	std::unique_ptr<Cell[]> _cells;
+	/// @brief The capacity minus one, used to wrap positions
+	std::size_t _mask;
+
+	/// @brief The position of the next value to enqueue
+	alignas(kCacheLineSize) std::atomic<std::size_t> _enqueuePosition { 0 };
+	/// @brief The position of the next value to dequeue
+	alignas(kCacheLineSize) std::atomic<std::size_t> _dequeuePosition { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
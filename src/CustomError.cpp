@@ -47,6 +47,15 @@ namespace
 		case CustomError::NoData:
 			return "no data was read yet"s;
 
+		case CustomError::WriteQueueFull:
+			return "too many values are waiting to be written"s;
+
+		case CustomError::RequestRejected:
+			return "the device rejected the request"s;
+
+		case CustomError::ResponseTimeout:
+			return "the device did not answer in time"s;
+
 		/// @todo Add messages for other error codes
 
 		case CustomError::UnknownError:
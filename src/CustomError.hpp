@@ -19,6 +19,12 @@ enum class CustomError
 	NotConnected,
 	/// @brief No data has been read yet.
 	NoData,
+	/// @brief A value could not be written because the write queue is full.
+	WriteQueueFull,
+	/// @brief The device rejected the request.
+	RequestRejected,
+	/// @brief The device did not answer a request in time.
+	ResponseTimeout,
 
 	/// @brief An unknown error occurred
 	UnknownError = 999
@@ -17,4 +17,25 @@ const process::Event::Role kRead { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid,
 /// @todo assign a unique UUID
 const process::Event::Role kWritten { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "written"sv };
 
+/// @todo assign a unique UUID
+const process::Event::Role kReadTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "readTaskOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kWriteTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "writeTaskOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kReconnectTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "reconnectTaskOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kBatchReadTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchReadTaskOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kBatchWriteTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchWriteTaskOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kFlushTraceTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "flushTraceTaskOverrun"sv };
+
+/// @todo assign a unique UUID
+const process::Event::Role kPublishStatisticsTaskOverrun { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "publishStatisticsTaskOverrun"sv };
+
 } // namespace xentara::plugins::templateDriver::events
\ No newline at end of file
@@ -11,5 +11,19 @@ namespace xentara::plugins::templateDriver::events
 extern const process::Event::Role kRead;
 /// @brief A Xentara event that is raised when a data point was written
 extern const process::Event::Role kWritten;
+/// @brief A Xentara event that is raised when the "read" task of a data point took longer than its period
+extern const process::Event::Role kReadTaskOverrun;
+/// @brief A Xentara event that is raised when the "write" task of a data point took longer than its period
+extern const process::Event::Role kWriteTaskOverrun;
+/// @brief A Xentara event that is raised when the "reconnect" task of an I/O component took longer than its period
+extern const process::Event::Role kReconnectTaskOverrun;
+/// @brief A Xentara event that is raised when the "batchRead" task of an I/O component took longer than its period
+extern const process::Event::Role kBatchReadTaskOverrun;
+/// @brief A Xentara event that is raised when the "batchWrite" task of an I/O component took longer than its period
+extern const process::Event::Role kBatchWriteTaskOverrun;
+/// @brief A Xentara event that is raised when the "flushTrace" task of an I/O component took longer than its period
+extern const process::Event::Role kFlushTraceTaskOverrun;
+/// @brief A Xentara event that is raised when the "publishStatistics" task of an I/O component took longer than its period
+extern const process::Event::Role kPublishStatisticsTaskOverrun;
 
 } // namespace xentara::plugins::templateDriver::events
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Copyright (c) embedded ocean GmbH
+#include "Handle.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+auto Handle::open() -> Handle
+{
+	/// @todo try to establish the connection, and store the connection in the handle
+
+	/// @todo if the connect function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	// Note: If your connect function uses normal system error codes (errno on Linux or GetLastError() on Windows), you
+	// should create std::error_codes using std::system_category(). If you are using a library and/or protocol that provides
+	// its own error codes, you should define a custom error category.
+
+	return Handle();
+}
+
+Handle::operator bool() const noexcept
+{
+	/// @todo return the actual state
+	return false;
+}
+
+auto Handle::close() noexcept -> void
+{
+	/// @todo close the connection, ignoring any errors. If the disconnect function can throw exceptions,
+	// these should be caught and ignored.
+}
+
+auto Handle::read(const AddressRange &range) const -> double
+{
+	/// @todo read the value of range._size address units starting at range._address
+
+	/// @todo if the read function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	return {};
+}
+
+auto Handle::sendReadRequest(const AddressRange &range) const -> void
+{
+	/// @todo send the read request without waiting for the response
+
+	/// @todo if the send function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+}
+
+auto Handle::receiveReadResponse(const AddressRange &range) const -> double
+{
+	/// @todo receive the response to the request sent by sendReadRequest()
+
+	/// @todo if the receive function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	return {};
+}
+
+auto Handle::sendBlockRequest(std::uint64_t transactionId, const AddressRange &block) const -> void
+{
+	/// @todo send a read request for block._size address units starting at block._address, tagged with transactionId,
+	// without waiting for the response.
+
+	/// @todo if the send function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+}
+
+auto Handle::receiveBlockResponse(std::span<std::byte> response) const -> std::optional<std::uint64_t>
+{
+	/// @todo receive the next response into the response buffer, and return its transaction ID
+
+	/// @todo if the receive function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	return std::nullopt;
+}
+
+auto Handle::decodeValue(std::span<const std::byte> response, const AddressRange &block, const AddressRange &range) const -> double
+{
+	/// @todo extract the value from the response, using the offset of range._address relative to block._address. If the
+	// response contains an error for this data point only, throw an std::system_error.
+
+	return {};
+}
+
+auto Handle::write(const AddressRange &range, double value) const -> void
+{
+	/// @todo write the value
+
+	/// @todo if the write function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+}
+
+auto Handle::writeSequence(const AddressRange &range, std::span<const double> values) const -> void
+{
+	/// @todo write all the values in a single request, in order
+
+	/// @todo if the write function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+}
+
+auto Handle::writeAndReadBack(const AddressRange &range, double value) const -> double
+{
+	/// @todo write the value and read it back using a single transaction, e.g. a combined write/read request,
+	// or a write request and a read request sent together without waiting for the response in between.
+
+	/// @todo if the transaction function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+
+	return {};
+}
+
+auto Handle::writeBlock(std::span<const AddressRange> ranges, std::span<const double> values) const -> void
+{
+	/// @todo write the values to the block of address units covered by the ranges using a single write request
+
+	/// @todo if the write function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+}
+
+auto Handle::writeTransaction(std::span<const AddressRange> ranges, std::span<const double> values) const -> void
+{
+	/// @todo write the values to the addresses using a single transaction, so that the device applies either all of them or none
+
+	/// @todo if the write function does not throw errors, but uses return types or internal handle state,
+	// throw an std::system_error here on failure.
+}
+
+} // namespace xentara::plugins::templateDriver
@@ -0,0 +1,85 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "RequestPlan.hpp"
+
+#include <xentara/utils/tools/Unique.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A handle used to access the physical device.
+///
+/// The I/O component and its data points send all their requests to the device using the handle of the I/O component,
+/// so that the protocol is implemented in a single place. All the request functions report errors by throwing an
+/// std::system_error, and may be called from several threads at once, except that sendBlockRequest() and receiveBlockResponse()
+/// are only ever called by one thread at a time.
+/// @todo implement a proper handle
+/// @todo use the correct value type
+class Handle final : private utils::tools::Unique
+{
+public:
+	/// @brief Establishes a connection to the device
+	/// @return A handle for the new connection
+	/// @throw std::system_error The connection could not be established
+	static auto open() -> Handle;
+
+	/// @brief determines of the I/O component is connected
+	explicit operator bool() const noexcept;
+
+	/// @brief Closes the connection, ignoring any errors
+	auto close() noexcept -> void;
+
+	/// @brief Reads the value of a data point, and waits for the response
+	auto read(const AddressRange &range) const -> double;
+
+	/// @brief Sends a read request for the value of a data point without waiting for the response
+	auto sendReadRequest(const AddressRange &range) const -> void;
+
+	/// @brief Waits for the response to the request sent for a data point using sendReadRequest()
+	auto receiveReadResponse(const AddressRange &range) const -> double;
+
+	/// @brief Sends a read request for a block of addresses without waiting for the response
+	/// @param transactionId The transaction ID to tag the request with
+	/// @param block The addresses to read
+	auto sendBlockRequest(std::uint64_t transactionId, const AddressRange &block) const -> void;
+
+	/// @brief Waits for the next response to a request sent using sendBlockRequest()
+	/// @param response A buffer that receives the response
+	/// @return The transaction ID of the request the response belongs to, or std::nullopt if the protocol has no transaction IDs,
+	/// and the responses arrive in the order the requests were sent
+	auto receiveBlockResponse(std::span<std::byte> response) const -> std::optional<std::uint64_t>;
+
+	/// @brief Gets the value of a data point from a response received using receiveBlockResponse()
+	/// @param response The response
+	/// @param block The addresses the request was sent for
+	/// @param range The addresses of the data point, which lie within the block
+	auto decodeValue(std::span<const std::byte> response, const AddressRange &block, const AddressRange &range) const -> double;
+
+	/// @brief Writes the value of a data point, and waits for the response
+	auto write(const AddressRange &range, double value) const -> void;
+
+	/// @brief Writes several values to a data point in order using a single request, and waits for the response
+	auto writeSequence(const AddressRange &range, std::span<const double> values) const -> void;
+
+	/// @brief Writes the value of a data point and reads it back using a single transaction, and waits for the response
+	/// @return The value read back
+	auto writeAndReadBack(const AddressRange &range, double value) const -> double;
+
+	/// @brief Writes the values of data points with neighbouring addresses using a single request, and waits for the response
+	/// @param ranges The addresses of the data points. These are sorted, and together cover a block of addresses without any gaps.
+	/// @param values The values, one for each data point
+	auto writeBlock(std::span<const AddressRange> ranges, std::span<const double> values) const -> void;
+
+	/// @brief Writes the values of several data points using a single transaction, so that the device applies either all of them or none
+	/// @param ranges The addresses of the data points
+	/// @param values The values, one for each data point
+	auto writeTransaction(std::span<const AddressRange> ranges, std::span<const double> values) const -> void;
+};
+
+} // namespace xentara::plugins::templateDriver
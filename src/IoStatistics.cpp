@@ -0,0 +1,199 @@
+// Copyright (c) embedded ocean GmbH
+#include "IoStatistics.hpp"
+
+#include "Attributes.hpp"
+
+#include <xentara/memory/memoryResources.hpp>
+#include <xentara/memory/WriteSentinel.hpp>
+
+#include <algorithm>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto IoStatistics::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
+{
+	// Handle all the attributes we support
+	return
+		function(attributes::kReadsPerSecond) ||
+		function(attributes::kWritesPerSecond) ||
+		function(attributes::kTimeoutErrors) ||
+		function(attributes::kConnectionErrors) ||
+		function(attributes::kRequestErrors) ||
+		function(attributes::kRoundTripMin) ||
+		function(attributes::kRoundTripAverage) ||
+		function(attributes::kRoundTripMax) ||
+		function(attributes::kBatchFillRatio);
+}
+
+auto IoStatistics::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	// Try each readable attribute
+	if (attribute == attributes::kReadsPerSecond)
+	{
+		return _dataBlock.member(&State::_readsPerSecond);
+	}
+	else if (attribute == attributes::kWritesPerSecond)
+	{
+		return _dataBlock.member(&State::_writesPerSecond);
+	}
+	else if (attribute == attributes::kTimeoutErrors)
+	{
+		return _dataBlock.member(&State::_timeoutErrors);
+	}
+	else if (attribute == attributes::kConnectionErrors)
+	{
+		return _dataBlock.member(&State::_connectionErrors);
+	}
+	else if (attribute == attributes::kRequestErrors)
+	{
+		return _dataBlock.member(&State::_requestErrors);
+	}
+	else if (attribute == attributes::kRoundTripMin)
+	{
+		return _dataBlock.member(&State::_roundTripMin);
+	}
+	else if (attribute == attributes::kRoundTripAverage)
+	{
+		return _dataBlock.member(&State::_roundTripAverage);
+	}
+	else if (attribute == attributes::kRoundTripMax)
+	{
+		return _dataBlock.member(&State::_roundTripMax);
+	}
+	else if (attribute == attributes::kBatchFillRatio)
+	{
+		return _dataBlock.member(&State::_batchFillRatio);
+	}
+
+	return std::nullopt;
+}
+
+auto IoStatistics::realize() -> void
+{
+	// Create the data block
+	_dataBlock.create(memory::memoryResources::data());
+
+	// Start the first interval
+	_intervalStart = std::chrono::steady_clock::now();
+}
+
+auto IoStatistics::recordRequest(std::chrono::nanoseconds roundTrip) noexcept -> void
+{
+	// Update the round trip times
+	const auto nanoseconds = roundTrip.count();
+	_current._roundTripTotal.fetch_add(nanoseconds, std::memory_order_relaxed);
+	auto min = _current._roundTripMin.load(std::memory_order_relaxed);
+	while (nanoseconds < min && !_current._roundTripMin.compare_exchange_weak(min, nanoseconds, std::memory_order_relaxed))
+	{
+	}
+	auto max = _current._roundTripMax.load(std::memory_order_relaxed);
+	while (nanoseconds > max && !_current._roundTripMax.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+	{
+	}
+}
+
+auto IoStatistics::recordError(ErrorCategory category) noexcept -> void
+{
+	switch (category)
+	{
+	case ErrorCategory::Timeout:
+		_timeoutErrors.fetch_add(1, std::memory_order_relaxed);
+		break;
+
+	case ErrorCategory::Connection:
+		_connectionErrors.fetch_add(1, std::memory_order_relaxed);
+		break;
+
+	case ErrorCategory::Request:
+	default:
+		_requestErrors.fetch_add(1, std::memory_order_relaxed);
+		break;
+	}
+}
+
+auto IoStatistics::takeCurrent() noexcept -> Interval
+{
+	// The counters are reset one at a time, so a request recorded at the same time may be split across two intervals.
+	// This is harmless for statistics.
+	Interval interval;
+	interval._reads = _current._reads.exchange(0, std::memory_order_relaxed);
+	interval._writes = _current._writes.exchange(0, std::memory_order_relaxed);
+	interval._roundTripTotal = std::chrono::nanoseconds(_current._roundTripTotal.exchange(0, std::memory_order_relaxed));
+	interval._roundTripMin = std::chrono::nanoseconds(
+		_current._roundTripMin.exchange(std::numeric_limits<std::int64_t>::max(), std::memory_order_relaxed));
+	interval._roundTripMax = std::chrono::nanoseconds(_current._roundTripMax.exchange(0, std::memory_order_relaxed));
+	interval._usedUnits = _current._usedUnits.exchange(0, std::memory_order_relaxed);
+	interval._blockUnits = _current._blockUnits.exchange(0, std::memory_order_relaxed);
+	return interval;
+}
+
+auto IoStatistics::publish(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Wait until the current interval is complete
+	const auto now = std::chrono::steady_clock::now();
+	if (now - _intervalStart < _window / kIntervalCount)
+	{
+		return;
+	}
+
+	// Close the current interval
+	auto &completed = _intervals[_nextInterval];
+	completed = takeCurrent();
+	completed._duration = now - _intervalStart;
+	_nextInterval = (_nextInterval + 1) % kIntervalCount;
+	_intervalStart = now;
+
+	// Add up the intervals that make up the window, starting with the newest one
+	Interval window;
+	std::uint64_t roundTrips = 0;
+	for (std::size_t age = 1; age <= kIntervalCount && window._duration < _window; ++age)
+	{
+		const auto &interval = _intervals[(_nextInterval + kIntervalCount - age) % kIntervalCount];
+		// Stop at intervals that have not been used yet
+		if (interval._duration.count() == 0)
+		{
+			break;
+		}
+
+		window._duration += interval._duration;
+		window._reads += interval._reads;
+		window._writes += interval._writes;
+		window._roundTripTotal += interval._roundTripTotal;
+		window._roundTripMin = std::min(window._roundTripMin, interval._roundTripMin);
+		window._roundTripMax = std::max(window._roundTripMax, interval._roundTripMax);
+		window._usedUnits += interval._usedUnits;
+		window._blockUnits += interval._blockUnits;
+		roundTrips += interval._reads + interval._writes;
+	}
+
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+	auto &state = *sentinel;
+
+	// Update the state. We must write all the members, because memory resources use swap-in.
+	const auto seconds = std::chrono::duration<double>(window._duration).count();
+	state._readsPerSecond = double(window._reads) / seconds;
+	state._writesPerSecond = double(window._writes) / seconds;
+	state._timeoutErrors = _timeoutErrors.load(std::memory_order_relaxed);
+	state._connectionErrors = _connectionErrors.load(std::memory_order_relaxed);
+	state._requestErrors = _requestErrors.load(std::memory_order_relaxed);
+	if (roundTrips > 0)
+	{
+		state._roundTripMin = window._roundTripMin;
+		state._roundTripAverage = window._roundTripTotal / roundTrips;
+		state._roundTripMax = window._roundTripMax;
+	}
+	else
+	{
+		state._roundTripMin = {};
+		state._roundTripAverage = {};
+		state._roundTripMax = {};
+	}
+	state._batchFillRatio = window._blockUnits > 0 ? double(window._usedUnits) / double(window._blockUnits) : 0.0;
+
+	// Commit the data. There are no events to raise.
+	sentinel.commit(timeStamp);
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,190 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/memory/ObjectBlock.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Request statistics of an I/O component.
+///
+/// Requests and errors can be recorded from any thread using relaxed atomic counters. The rates, the round trip times
+/// and the batch fill ratio are computed over a sliding window. The error counts are totals since startup.
+class IoStatistics final
+{
+public:
+	/// @brief The categories errors are counted in
+	enum class ErrorCategory
+	{
+		/// @brief The device did not respond in time
+		Timeout,
+		/// @brief The connection to the device failed
+		Connection,
+		/// @brief A single request failed, without affecting the connection
+		Request
+	};
+
+	/// @brief Sets the length of the sliding window.
+	/// @note This must be called before the statistics are realized.
+	auto setWindow(std::chrono::nanoseconds window) noexcept -> void
+	{
+		_window = window;
+	}
+
+	/// @brief Iterates over all the attributes that belong to the statistics.
+	/// @param function The function that should be called for each attribute
+	/// @return The return value of the last function call
+	auto forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool;
+
+	/// @brief Creates a read-handle for an attribute that belong to the statistics.
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+
+	/// @brief Realizes the statistics
+	auto realize() -> void;
+
+	/// @brief Records a successful read request
+	/// @param roundTrip The time from sending the request to receiving the response
+	auto recordRead(std::chrono::nanoseconds roundTrip) noexcept -> void
+	{
+		_current._reads.fetch_add(1, std::memory_order_relaxed);
+		recordRequest(roundTrip);
+	}
+
+	/// @brief Records a successful write request
+	/// @param roundTrip The time from sending the request to receiving the acknowledgement
+	auto recordWrite(std::chrono::nanoseconds roundTrip) noexcept -> void
+	{
+		_current._writes.fetch_add(1, std::memory_order_relaxed);
+		recordRequest(roundTrip);
+	}
+
+	/// @brief Records a block request that covers several data points
+	/// @param usedUnits The number of address units in the block that belong to a data point
+	/// @param blockUnits The total number of address units in the block
+	auto recordBlock(std::size_t usedUnits, std::size_t blockUnits) noexcept -> void
+	{
+		_current._usedUnits.fetch_add(usedUnits, std::memory_order_relaxed);
+		_current._blockUnits.fetch_add(blockUnits, std::memory_order_relaxed);
+	}
+
+	/// @brief Records an error
+	auto recordError(ErrorCategory category) noexcept -> void;
+
+	/// @brief Writes the current statistics to the data block.
+	///
+	/// The statistics are only written once per 1/kIntervalCount of the window, so this can be called as often as desired.
+	/// This function must not be called from more than one thread at a time.
+	/// @param timeStamp The update time stamp
+	auto publish(std::chrono::system_clock::time_point timeStamp) -> void;
+
+private:
+	/// @brief The number of intervals the sliding window is divided into
+	static constexpr std::size_t kIntervalCount = 16;
+
+	/// @brief The statistics collected during an interval
+	struct Interval final
+	{
+		/// @brief The length of the interval, or 0 if the interval has not been used yet
+		std::chrono::nanoseconds _duration { 0 };
+		/// @brief The number of successful read requests
+		std::uint64_t _reads { 0 };
+		/// @brief The number of successful write requests
+		std::uint64_t _writes { 0 };
+		/// @brief The sum of all the round trip times
+		std::chrono::nanoseconds _roundTripTotal { 0 };
+		/// @brief The shortest round trip time
+		std::chrono::nanoseconds _roundTripMin { std::chrono::nanoseconds::max() };
+		/// @brief The longest round trip time
+		std::chrono::nanoseconds _roundTripMax { 0 };
+		/// @brief The number of address units in block requests that belong to a data point
+		std::uint64_t _usedUnits { 0 };
+		/// @brief The total number of address units in block requests
+		std::uint64_t _blockUnits { 0 };
+	};
+
+	/// @brief The statistics of the interval currently being collected, which are updated from any thread
+	struct Counters final
+	{
+		/// @brief The number of successful read requests
+		std::atomic<std::uint64_t> _reads { 0 };
+		/// @brief The number of successful write requests
+		std::atomic<std::uint64_t> _writes { 0 };
+		/// @brief The sum of all the round trip times in nanoseconds
+		std::atomic<std::int64_t> _roundTripTotal { 0 };
+		/// @brief The shortest round trip time in nanoseconds
+		std::atomic<std::int64_t> _roundTripMin { std::numeric_limits<std::int64_t>::max() };
+		/// @brief The longest round trip time in nanoseconds
+		std::atomic<std::int64_t> _roundTripMax { 0 };
+		/// @brief The number of address units in block requests that belong to a data point
+		std::atomic<std::uint64_t> _usedUnits { 0 };
+		/// @brief The total number of address units in block requests
+		std::atomic<std::uint64_t> _blockUnits { 0 };
+	};
+
+	/// @brief This structure is used to represent the statistics inside the memory block
+	struct State final
+	{
+		/// @brief The number of successful read requests per second
+		double _readsPerSecond { 0 };
+		/// @brief The number of successful write requests per second
+		double _writesPerSecond { 0 };
+		/// @brief The total number of timeouts
+		std::uint64_t _timeoutErrors { 0 };
+		/// @brief The total number of connection errors
+		std::uint64_t _connectionErrors { 0 };
+		/// @brief The total number of errors that only affected a single request
+		std::uint64_t _requestErrors { 0 };
+		/// @brief The shortest round trip time
+		std::chrono::nanoseconds _roundTripMin { 0 };
+		/// @brief The average round trip time
+		std::chrono::nanoseconds _roundTripAverage { 0 };
+		/// @brief The longest round trip time
+		std::chrono::nanoseconds _roundTripMax { 0 };
+		/// @brief The fraction of the address units in block requests that belong to a data point
+		double _batchFillRatio { 0 };
+	};
+
+	/// @brief Records the round trip time of a successful request
+	auto recordRequest(std::chrono::nanoseconds roundTrip) noexcept -> void;
+
+	/// @brief Moves the statistics collected so far out of _current, and resets them
+	auto takeCurrent() noexcept -> Interval;
+
+	/// @brief The length of the sliding window
+	std::chrono::nanoseconds _window { std::chrono::seconds(10) };
+
+	/// @brief The statistics of the current interval
+	Counters _current;
+
+	/// @brief The total number of timeouts
+	std::atomic<std::uint64_t> _timeoutErrors { 0 };
+	/// @brief The total number of connection errors
+	std::atomic<std::uint64_t> _connectionErrors { 0 };
+	/// @brief The total number of errors that only affected a single request
+	std::atomic<std::uint64_t> _requestErrors { 0 };
+
+	/// @brief The completed intervals, used as a ring buffer
+	/// @note This is only used by the thread that calls publish().
+	std::array<Interval, kIntervalCount> _intervals;
+	/// @brief The index of the slot in _intervals the next completed interval will be stored in
+	std::size_t _nextInterval { 0 };
+	/// @brief The time the current interval started
+	std::chrono::steady_clock::time_point _intervalStart;
+
+	/// @brief The data block that contains the statistics
+	memory::ObjectBlock<State> _dataBlock;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
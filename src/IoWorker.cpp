@@ -0,0 +1,107 @@
+// Copyright (c) embedded ocean GmbH
+#include "IoWorker.hpp"
+
+namespace xentara::plugins::templateDriver
+{
+
+auto IoWorker::start() -> void
+{
+	// Don't start a second thread
+	if (_thread.joinable())
+	{
+		return;
+	}
+
+	_thread = std::jthread([this](std::stop_token stopToken) { run(stopToken); });
+}
+
+auto IoWorker::stop() -> void
+{
+	// Nothing to do if the thread is not running
+	if (!_thread.joinable())
+	{
+		return;
+	}
+
+	// Tell the thread to stop, and wake it up in case it is waiting
+	_thread.request_stop();
+	_postCount.fetch_add(1, std::memory_order_release);
+	_postCount.notify_one();
+
+	// Wait for the thread to finish
+	_thread.join();
+
+	// Throw away any jobs that were not executed, so that they can be posted again
+	discardRequests();
+}
+
+auto IoWorker::post(Job &job, std::chrono::system_clock::time_point timeStamp) noexcept -> bool
+{
+	// Don't post the job if it is still queued
+	if (job._posted.test_and_set(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	// Enqueue the job
+	if (!_queue.tryEnqueue({ &job, timeStamp }))
+	{
+		job._posted.clear(std::memory_order_release);
+		return false;
+	}
+
+	// Wake up the worker thread
+	_postCount.fetch_add(1, std::memory_order_release);
+	_postCount.notify_one();
+
+	return true;
+}
+
+auto IoWorker::run(std::stop_token stopToken) -> void
+{
+	while (!stopToken.stop_requested())
+	{
+		// Remember the post count before looking at the queue, so that we cannot miss a wakeup
+		const auto postCount = _postCount.load(std::memory_order_acquire);
+
+		// Execute all queued jobs
+		while (auto request = _queue.tryDequeue())
+		{
+			auto &job = *request->_job;
+
+			// Allow the job to be posted again before executing it, so that a new request made while the I/O is in
+			// progress is not lost
+			job._posted.clear(std::memory_order_release);
+
+			// Execute the job, timing it with the monitor of its task. The lateness includes the time the job spent in the queue.
+			if (job._monitor)
+			{
+				const auto execution = job._monitor->start(request->_timeStamp);
+				job.execute(request->_timeStamp);
+				job._monitor->finish(execution);
+			}
+			else
+			{
+				job.execute(request->_timeStamp);
+			}
+
+			if (stopToken.stop_requested())
+			{
+				return;
+			}
+		}
+
+		// Wait for new jobs
+		_postCount.wait(postCount, std::memory_order_acquire);
+	}
+}
+
+auto IoWorker::discardRequests() noexcept -> void
+{
+	while (auto request = _queue.tryDequeue())
+	{
+		request->_job->_posted.clear(std::memory_order_release);
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
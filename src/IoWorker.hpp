@@ -0,0 +1,112 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "BoundedQueue.hpp"
+#include "TaskMonitor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stop_token>
+#include <thread>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A worker thread that performs device I/O on behalf of the Xentara scheduler threads.
+///
+/// Jobs are handed to the worker using a lock-free queue, so that posting a job never blocks the scheduler thread,
+/// regardless of how long the device takes to respond.
+class IoWorker final
+{
+public:
+	/// @brief Interface for jobs that can be executed by the worker
+	class Job
+	{
+	public:
+		/// @brief Virtual destructor
+		/// @note The destructor is pure virtual (= 0) to ensure that this class will remain abstract, even if we should remove all
+		/// other pure virtual functions later.
+		virtual ~Job() = 0;
+
+		/// @brief Called on the worker thread to execute the job
+		/// @param timeStamp The time stamp that was passed to post()
+		virtual auto execute(std::chrono::system_clock::time_point timeStamp) -> void = 0;
+
+	protected:
+		/// @brief Constructor
+		/// @param monitor The monitor of the task the job belongs to, or nullptr if the job should not be timed. The worker
+		/// times the executions of the job using this monitor, so that the time the device takes counts towards overruns
+		/// of the task.
+		explicit Job(TaskMonitor *monitor = nullptr) noexcept : _monitor(monitor)
+		{
+		}
+
+	private:
+		/// @brief The worker needs access to the private members
+		friend class IoWorker;
+
+		/// @brief The monitor the executions of the job are timed with, or nullptr
+		TaskMonitor *_monitor;
+		/// @brief Set while the job is in the queue, so that it will not be queued twice
+		std::atomic_flag _posted;
+	};
+
+	/// @brief Constructor
+	/// @param capacity The number of jobs that may be queued at the same time. This should be at least the number of
+	/// different jobs that will be posted, because each job is only queued once.
+	explicit IoWorker(std::size_t capacity) : _queue(capacity)
+	{
+	}
+
+	/// @brief Starts the worker thread, if it is not already running
+	auto start() -> void;
+
+	/// @brief Stops the worker thread and discards any jobs that have not been executed yet.
+	///
+	/// This function waits for the job currently being executed to complete.
+	auto stop() -> void;
+
+	/// @brief Posts a job to be executed on the worker thread.
+	///
+	/// This function never blocks. If the job is still queued from an earlier call, it is not queued again,
+	/// so a job whose I/O takes longer than its cycle skips cycles rather than piling up.
+	/// @param job The job to execute
+	/// @param timeStamp The time stamp to pass to the job. This must be the scheduled time of the task the job belongs to,
+	/// because the worker measures the lateness of the job from it.
+	/// @return true if the job was queued, or false if it was already queued, or the queue was full
+	auto post(Job &job, std::chrono::system_clock::time_point timeStamp) noexcept -> bool;
+
+private:
+	/// @brief A request in the queue
+	/// @note The members have no default initializers, because that would prevent the queue from default constructing requests
+	/// inside the class definition. The queue value-initializes its cells, which sets them to zero anyway.
+	struct Request final
+	{
+		/// @brief The job to execute
+		Job *_job;
+		/// @brief The time stamp to pass to the job
+		std::chrono::system_clock::time_point _timeStamp;
+	};
+
+	/// @brief The main function of the worker thread
+	auto run(std::stop_token stopToken) -> void;
+
+	/// @brief Removes all requests from the queue without executing them
+	auto discardRequests() noexcept -> void;
+
+	/// @brief The queue of pending requests
+	BoundedQueue<Request> _queue;
+
+	/// @brief A counter that is incremented for each posted request, and used to wake up the worker thread
+	std::atomic<std::uint64_t> _postCount { 0 };
+
+	/// @brief The worker thread.
+	/// @note This must be the last member, so that the thread is joined before any data it uses is destroyed.
+	std::jthread _thread;
+};
+
+inline IoWorker::Job::~Job() = default;
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
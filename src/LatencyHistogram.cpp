@@ -0,0 +1,80 @@
+// Copyright (c) embedded ocean GmbH
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto LatencyHistogram::record(std::chrono::nanoseconds latency) noexcept -> void
+{
+	// Negative latencies can only result from clock adjustments, so we count them as zero
+	const auto nanoseconds = std::uint64_t(std::max<std::chrono::nanoseconds::rep>(latency.count(), 0));
+
+	_buckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+	_count.fetch_add(1, std::memory_order_relaxed);
+
+	// Update the maximum
+	auto max = _max.load(std::memory_order_relaxed);
+	while (nanoseconds > max && !_max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+	{
+	}
+}
+
+auto LatencyHistogram::percentile(double fraction) const noexcept -> std::chrono::nanoseconds
+{
+	// Find the number of latencies that must lie at or below the percentile
+	const auto count = _count.load(std::memory_order_relaxed);
+	if (count == 0)
+	{
+		return std::chrono::nanoseconds::zero();
+	}
+	const auto rank = std::max<std::uint64_t>(std::uint64_t(std::ceil(double(count) * fraction)), 1);
+
+	// Find the bucket containing that rank
+	std::uint64_t total = 0;
+	for (std::size_t index = 0; index < kBucketCount; ++index)
+	{
+		total += _buckets[index].load(std::memory_order_relaxed);
+		if (total >= rank)
+		{
+			// The upper bound of the bucket may be larger than any latency actually recorded
+			return std::chrono::nanoseconds(std::min(bucketUpperBound(index), _max.load(std::memory_order_relaxed)));
+		}
+	}
+
+	// We can only get here if latencies were recorded while we were counting
+	return max();
+}
+
+auto LatencyHistogram::bucketIndex(std::uint64_t nanoseconds) noexcept -> std::size_t
+{
+	// Small values each get a bucket of their own
+	if (nanoseconds < kSubBuckets)
+	{
+		return std::size_t(nanoseconds);
+	}
+
+	// Use the most significant bit to select the power of two, and the bits below it to select the sub bucket
+	const auto exponent = unsigned(std::bit_width(nanoseconds)) - 1;
+	const auto subBucket = (nanoseconds >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+	return (exponent - kSubBucketBits + 1) * kSubBuckets + std::size_t(subBucket);
+}
+
+auto LatencyHistogram::bucketUpperBound(std::size_t index) noexcept -> std::uint64_t
+{
+	// Small values each have a bucket of their own
+	if (index < kSubBuckets)
+	{
+		return std::uint64_t(index);
+	}
+
+	// Reverse the calculation in bucketIndex(). The last bucket wraps around to the largest 64 bit value.
+	const auto exponent = unsigned(index / kSubBuckets) + kSubBucketBits - 1;
+	const auto subBucket = std::uint64_t(index % kSubBuckets);
+	return ((kSubBuckets + subBucket + 1) << (exponent - kSubBucketBits)) - 1;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
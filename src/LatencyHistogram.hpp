@@ -0,0 +1,64 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A thread-safe, lock-free histogram of latencies.
+///
+/// The histogram uses a fixed set of buckets on a logarithmic scale, with four buckets for each power of two. This
+/// means that percentiles are accurate to within 25%, regardless of the magnitude of the latencies.
+///
+/// Any number of threads may record latencies at the same time. Reading the percentiles while latencies are being
+/// recorded yields a result that is approximately consistent.
+class LatencyHistogram final
+{
+public:
+	/// @brief Records a latency
+	auto record(std::chrono::nanoseconds latency) noexcept -> void;
+
+	/// @brief Gets the number of latencies recorded
+	auto count() const noexcept -> std::uint64_t
+	{
+		return _count.load(std::memory_order_relaxed);
+	}
+
+	/// @brief Gets a percentile of the recorded latencies
+	/// @param fraction The percentile as a fraction between 0 and 1, e.g. 0.99 for the 99th percentile
+	/// @return The upper bound of the bucket containing the percentile, or 0 if nothing was recorded yet
+	auto percentile(double fraction) const noexcept -> std::chrono::nanoseconds;
+
+	/// @brief Gets the largest latency recorded
+	auto max() const noexcept -> std::chrono::nanoseconds
+	{
+		return std::chrono::nanoseconds(_max.load(std::memory_order_relaxed));
+	}
+
+private:
+	/// @brief The number of bits used to subdivide each power of two
+	static constexpr unsigned kSubBucketBits = 2;
+	/// @brief The number of buckets for each power of two
+	static constexpr std::size_t kSubBuckets = std::size_t(1) << kSubBucketBits;
+	/// @brief The total number of buckets, which covers the entire range of 64 bit values
+	static constexpr std::size_t kBucketCount = 64 * kSubBuckets;
+
+	/// @brief Gets the index of the bucket for a latency in nanoseconds
+	static auto bucketIndex(std::uint64_t nanoseconds) noexcept -> std::size_t;
+	/// @brief Gets the largest latency in nanoseconds that falls into a bucket
+	static auto bucketUpperBound(std::size_t index) noexcept -> std::uint64_t;
+
+	/// @brief The number of latencies recorded in each bucket
+	std::array<std::atomic<std::uint64_t>, kBucketCount> _buckets {};
+	/// @brief The total number of latencies recorded
+	std::atomic<std::uint64_t> _count { 0 };
+	/// @brief The largest latency recorded, in nanoseconds
+	std::atomic<std::uint64_t> _max { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
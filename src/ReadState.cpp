@@ -4,12 +4,18 @@
 #include "Attributes.hpp"
 
 #include <xentara/memory/memoryResources.hpp>
+#include <xentara/memory/ReadSentinel.hpp>
 #include <xentara/memory/WriteSentinel.hpp>
 #include <xentara/process/EventList.hpp>
 
+#include <cmath>
+#include <string_view>
+
 namespace xentara::plugins::templateDriver
 {
 
+using namespace std::literals;
+
 template <std::regular DataType>
 auto ReadState<DataType>::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
 {
@@ -59,6 +65,12 @@ auto ReadState<DataType>::valueReadHandle() const noexcept -> data::ReadHandle
 	return _dataBlock.member(&State::_value);
 }
 
+template <std::regular DataType>
+auto ReadState<DataType>::writeDerivedReadHandle() const noexcept -> data::ReadHandle
+{
+	return _dataBlock.member(&State::_writeDerived);
+}
+
 template <std::regular DataType>
 auto ReadState<DataType>::realize() -> void
 {
@@ -69,18 +81,133 @@ auto ReadState<DataType>::realize() -> void
 template <std::regular DataType>
 auto ReadState<DataType>::update(std::chrono::system_clock::time_point timeStamp, const utils::eh::expected<DataType, std::error_code> &valueOrError) -> void
 {
+	// Skip the write entirely if nothing changed
+	if (isRedundantUpdate(timeStamp, valueOrError, false))
+	{
+		return;
+	}
+
+	Tracer::Span span { _tracer, "commitReadState"sv };
+
 	// Make a write sentinel
 	memory::WriteSentinel sentinel { _dataBlock };
-	auto &state = *sentinel;
-	const auto &oldState = sentinel.oldValue();
 
+	// Update the state
+	const auto changed = applyUpdate(*sentinel, sentinel.oldValue(), timeStamp, valueOrError, false);
+
+	// Collect the events to raise
+	process::StaticEventList<1> events;
+	if (changed)
+	{
+		events.push_back(_changedEvent);
+	}
+
+	// Commit the data and raise the events
+	sentinel.commit(timeStamp, events);
+}
+
+template <std::regular DataType>
+auto ReadState<DataType>::update(std::chrono::system_clock::time_point timeStamp,
+	const utils::eh::expected<DataType, std::error_code> &valueOrError,
+	process::DynamicEventList &events) -> void
+{
+	// Skip the write entirely if nothing changed
+	if (isRedundantUpdate(timeStamp, valueOrError, false))
+	{
+		return;
+	}
+
+	Tracer::Span span { _tracer, "commitReadState"sv };
+
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+
+	// Update the state
+	const auto changed = applyUpdate(*sentinel, sentinel.oldValue(), timeStamp, valueOrError, false);
+
+	// Commit the data without raising any events
+	sentinel.commit(timeStamp);
+
+	// Let the caller raise the event
+	if (changed)
+	{
+		events.push_back(_changedEvent);
+	}
+}
+
+template <std::regular DataType>
+auto ReadState<DataType>::updateFromWrite(std::chrono::system_clock::time_point timeStamp, const DataType &value) -> void
+{
+	// Skip the write entirely if nothing changed
+	if (isRedundantUpdate(timeStamp, value, true))
+	{
+		return;
+	}
+
+	Tracer::Span span { _tracer, "commitReadState"sv };
+
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+
+	// Update the state
+	const auto changed = applyUpdate(*sentinel, sentinel.oldValue(), timeStamp, value, true);
+
+	// Collect the events to raise
+	process::StaticEventList<1> events;
+	if (changed)
+	{
+		events.push_back(_changedEvent);
+	}
+
+	// Commit the data and raise the events
+	sentinel.commit(timeStamp, events);
+}
+
+template <std::regular DataType>
+auto ReadState<DataType>::updateFromWrite(std::chrono::system_clock::time_point timeStamp,
+	const DataType &value,
+	process::DynamicEventList &events) -> void
+{
+	// Skip the write entirely if nothing changed
+	if (isRedundantUpdate(timeStamp, value, true))
+	{
+		return;
+	}
+
+	Tracer::Span span { _tracer, "commitReadState"sv };
+
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+
+	// Update the state
+	const auto changed = applyUpdate(*sentinel, sentinel.oldValue(), timeStamp, value, true);
+
+	// Commit the data without raising any events
+	sentinel.commit(timeStamp);
+
+	// Let the caller raise the event
+	if (changed)
+	{
+		events.push_back(_changedEvent);
+	}
+}
+
+template <std::regular DataType>
+auto ReadState<DataType>::applyUpdate(State &state,
+	const State &oldState,
+	std::chrono::system_clock::time_point timeStamp,
+	const utils::eh::expected<DataType, std::error_code> &valueOrError,
+	bool writeDerived) const -> bool
+{
 	state._updateTime = timeStamp;
+	state._writeDerived = writeDerived && valueOrError.has_value();
 
 	// See if we have a value
 	if (valueOrError)
 	{
-		// Set the value
-		state._value = *valueOrError;
+		// Set the value, unless the change is too small to be reported. We compare against the last reported value,
+		// so that a slow drift is reported once it adds up to a significant change.
+		state._value = isSignificantChange(*valueOrError, oldState, timeStamp) ? *valueOrError : oldState._value;
 
 		// Reset the error
 		state._quality = data::Quality::Good;
@@ -107,15 +234,76 @@ auto ReadState<DataType>::update(std::chrono::system_clock::time_point timeStamp
 	// because memory resources use swap-in.
 	state._changeTime = changed ? timeStamp : oldState._changeTime;
 
-	// Collect the events to raise
-	process::StaticEventList<1> events;
-	if (changed)
+	return changed;
+}
+
+template <std::regular DataType>
+auto ReadState<DataType>::isRedundantUpdate(std::chrono::system_clock::time_point timeStamp,
+	const utils::eh::expected<DataType, std::error_code> &valueOrError,
+	bool writeDerived) const -> bool
+{
+	// Every update is written if report by exception is not enabled
+	if (!_reportByException)
 	{
-		events.push_back(_changedEvent);
+		return false;
 	}
 
-	// Commit the data and raise the events
-	sentinel.commit(timeStamp, events);
+	// Get the current state without opening the block for writing
+	memory::ReadSentinel sentinel { _dataBlock };
+	const auto &oldState = *sentinel;
+
+	// Write the state anyway if the heartbeat is due. We add to the old update time rather than subtracting from the time stamp,
+	// because the initial update time is the minimum time point, and subtracting that would overflow.
+	if (_heartbeatInterval.count() > 0 && oldState._updateTime + _heartbeatInterval <= timeStamp)
+	{
+		return false;
+	}
+
+	// Apply the update to a scratch copy, and see if anything changed. A change of the write derived flag does not raise
+	// a changed event, but must still be written.
+	State newState;
+	const auto changed = applyUpdate(newState, oldState, timeStamp, valueOrError, writeDerived);
+	return !changed && newState._writeDerived == oldState._writeDerived;
+}
+
+template <std::regular DataType>
+auto ReadState<DataType>::isSignificantChange(const DataType &value,
+	const State &oldState,
+	std::chrono::system_clock::time_point timeStamp) const -> bool
+{
+	// If the last reported value was invalid, any value is significant
+	if (oldState._quality != data::Quality::Good)
+	{
+		return true;
+	}
+
+	// Identical values are never a change
+	if (value == oldState._value)
+	{
+		return false;
+	}
+
+	// Suppress changes that come too soon after the last one
+	if (_changeFilter._minChangeInterval.count() > 0 && timeStamp - oldState._changeTime < _changeFilter._minChangeInterval)
+	{
+		return false;
+	}
+
+	// Apply the deadbands for arithmetic types
+	if constexpr (std::is_arithmetic_v<DataType>)
+	{
+		const auto difference = std::abs(double(value) - double(oldState._value));
+		if (difference <= _changeFilter._absoluteDeadband)
+		{
+			return false;
+		}
+		if (difference <= std::abs(double(oldState._value)) * _changeFilter._percentDeadband / 100.0)
+		{
+			return false;
+		}
+	}
+
+	return true;
 }
 
 /// @class xentara::plugins::templateDriver::ReadState
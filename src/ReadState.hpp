@@ -3,6 +3,7 @@
 
 #include "Attributes.hpp"
 #include "CustomError.hpp"
+#include "Tracer.hpp"
 
 #include <xentara/data/Quality.hpp>
 #include <xentara/data/ReadHandle.hpp>
@@ -10,12 +11,14 @@
 #include <xentara/model/ForEachAttributeFunction.hpp>
 #include <xentara/model/ForEachEventFunction.hpp>
 #include <xentara/process/Event.hpp>
+#include <xentara/process/EventList.hpp>
 #include <xentara/utils/eh/expected.hpp>
 
 #include <chrono>
 #include <concepts>
 #include <optional>
 #include <memory>
+#include <type_traits>
 
 namespace xentara::plugins::templateDriver
 {
@@ -25,6 +28,49 @@ template <std::regular DataType>
 class ReadState final
 {
 public:
+	/// @brief Settings that determine which value changes are significant enough to be reported.
+	///
+	/// Changes that are not significant do not update the value, the change time, or raise the changed event.
+	/// Changes to the quality or the error are always significant.
+	struct ChangeFilter final
+	{
+		/// @brief The minimum absolute difference from the last reported value, or 0 for none.
+		/// @note This is only used for arithmetic data types.
+		double _absoluteDeadband { 0 };
+		/// @brief The minimum difference from the last reported value, in percent of that value, or 0 for none.
+		/// @note This is only used for arithmetic data types.
+		double _percentDeadband { 0 };
+		/// @brief The minimum time between two reported value changes
+		std::chrono::nanoseconds _minChangeInterval { 0 };
+	};
+
+	/// @brief Sets the filter used to suppress insignificant value changes.
+	/// @note This must be called before the state is realized.
+	auto setChangeFilter(const ChangeFilter &changeFilter) noexcept -> void
+	{
+		_changeFilter = changeFilter;
+	}
+
+	/// @brief Enables or disables report by exception.
+	///
+	/// In report by exception mode, updates that do not change the value, the quality, or the error are not written to
+	/// memory at all, so the update time only moves on changes and heartbeats.
+	/// @param enabled Whether to enable report by exception
+	/// @param heartbeatInterval The maximum time between two writes, even if nothing changed, or 0 to only write on changes.
+	/// @note This must be called before the state is realized.
+	auto setReportByException(bool enabled, std::chrono::nanoseconds heartbeatInterval) noexcept -> void
+	{
+		_reportByException = enabled;
+		_heartbeatInterval = heartbeatInterval;
+	}
+
+	/// @brief Sets the tracer that commits of the state should be recorded on
+	/// @param tracer The tracer, or nullptr to disable tracing
+	auto setTracer(Tracer *tracer) noexcept -> void
+	{
+		_tracer = tracer;
+	}
+
 	/// @brief Iterates over all the attributes that belong to this state.
 	/// @param function The function that should be called for each attribute
 	/// @return The return value of the last function call
@@ -52,6 +98,11 @@ public:
 	/// @return A read handle to the value attribute
 	auto valueReadHandle() const noexcept -> data::ReadHandle;
 
+	/// @brief Creates a read-handle for the write derived attribute.
+	/// @note The write derived attribute is not handled by makeReadHandle(), because only data points that use write-through have it.
+	/// @return A read handle to the write derived attribute
+	auto writeDerivedReadHandle() const noexcept -> data::ReadHandle;
+
 	/// @brief Realizes the state
 	auto realize() -> void;
 
@@ -61,6 +112,32 @@ public:
 	/// containing an read error
 	auto update(std::chrono::system_clock::time_point timeStamp, const utils::eh::expected<DataType, std::error_code> &valueOrError) -> void;
 
+	/// @brief Updates the data, but leaves raising the events to the caller
+	/// @param timeStamp The update time stamp
+	/// @param valueOrError This is a variant-like type that will hold either the new value, or an std::error_code object
+	/// containing an read error
+	/// @param events A list that any events that must be raised are appended to. The caller must raise these events
+	/// after the data was committed.
+	auto update(std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<DataType, std::error_code> &valueOrError,
+		process::DynamicEventList &events) -> void;
+
+	/// @brief Updates the data with a value that was successfully written to the device, and sends events
+	///
+	/// The value is marked as write derived until the next update.
+	/// @param timeStamp The update time stamp
+	/// @param value The value that was written
+	auto updateFromWrite(std::chrono::system_clock::time_point timeStamp, const DataType &value) -> void;
+
+	/// @brief Updates the data with a value that was successfully written to the device, but leaves raising the events to the caller
+	///
+	/// The value is marked as write derived until the next update.
+	/// @param timeStamp The update time stamp
+	/// @param value The value that was written
+	/// @param events A list that any events that must be raised are appended to. The caller must raise these events
+	/// after the data was committed.
+	auto updateFromWrite(std::chrono::system_clock::time_point timeStamp, const DataType &value, process::DynamicEventList &events) -> void;
+
 private:
 	/// @brief This structure is used to represent the state inside the memory block
 	struct State final
@@ -75,8 +152,39 @@ private:
 		data::Quality _quality { data::Quality::Bad };
 		/// @brief The error code when reading the value, or a default constructed std::error_code object for none.
 		std::error_code _error { CustomError::NotConnected };
+		/// @brief Whether the value was taken from a write rather than read from the device
+		bool _writeDerived { false };
 	};
 
+	/// @brief Fills in the new state for an update
+	/// @return Whether anything changed that warrants a changed event
+	auto applyUpdate(State &state,
+		const State &oldState,
+		std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<DataType, std::error_code> &valueOrError,
+		bool writeDerived) const -> bool;
+
+	/// @brief Checks whether an update can be skipped in report by exception mode
+	auto isRedundantUpdate(std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<DataType, std::error_code> &valueOrError,
+		bool writeDerived) const -> bool;
+
+	/// @brief Checks whether a new value differs enough from the last reported value to be reported
+	auto isSignificantChange(const DataType &value,
+		const State &oldState,
+		std::chrono::system_clock::time_point timeStamp) const -> bool;
+
+	/// @brief The filter used to suppress insignificant value changes
+	ChangeFilter _changeFilter;
+
+	/// @brief Whether to skip updates that do not change anything
+	bool _reportByException { false };
+	/// @brief The maximum time between two writes in report by exception mode, or 0 for none
+	std::chrono::nanoseconds _heartbeatInterval { 0 };
+
+	/// @brief The tracer that commits are recorded on, or nullptr if tracing is disabled
+	Tracer *_tracer { nullptr };
+
 	/// @brief A summary event that is raised when anything changes
 	process::Event _changedEvent { io::Direction::Input };
 
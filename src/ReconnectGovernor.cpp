@@ -0,0 +1,82 @@
+// Copyright (c) embedded ocean GmbH
+#include "ReconnectGovernor.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto ReconnectGovernor::tryAcquire(Waiter &waiter) -> std::optional<Grant>
+{
+	const auto now = std::chrono::steady_clock::now();
+
+	std::scoped_lock lock { _mutex };
+
+	// Queue the waiter, if it is not queued already
+	if (!waiter._queued)
+	{
+		waiter._queued = true;
+		waiter._enqueueTime = now;
+		_queue.push_back(&waiter);
+	}
+	waiter._pollTime = now;
+
+	// Remove the waiters that have stopped asking, so that they do not hold up the ones behind them
+	std::erase_if(_queue, [&](Waiter *queued) {
+		if (now - queued->_pollTime <= queued->_staleTimeout)
+		{
+			return false;
+		}
+		queued->_queued = false;
+		return true;
+	});
+
+	// Only the waiters at the front of the queue may use the free slots, so that clients are served in order
+	const auto freeSlots = _maxConcurrentAttempts - std::min(_attemptsInProgress, _maxConcurrentAttempts);
+	const auto end = std::next(_queue.begin(), std::ptrdiff_t(std::min(freeSlots, _queue.size())));
+	const auto position = std::find(_queue.begin(), end, &waiter);
+	if (position == end)
+	{
+		return std::nullopt;
+	}
+
+	// Grant the slot
+	_queue.erase(position);
+	waiter._queued = false;
+	++_attemptsInProgress;
+
+	return Grant { now - waiter._enqueueTime, _queue.size() };
+}
+
+auto ReconnectGovernor::release() -> void
+{
+	std::scoped_lock lock { _mutex };
+
+	if (_attemptsInProgress > 0)
+	{
+		--_attemptsInProgress;
+	}
+}
+
+auto ReconnectGovernor::withdraw(Waiter &waiter) -> void
+{
+	std::scoped_lock lock { _mutex };
+
+	if (!waiter._queued)
+	{
+		return;
+	}
+
+	std::erase(_queue, &waiter);
+	waiter._queued = false;
+}
+
+auto ReconnectGovernor::queueDepth() const -> std::size_t
+{
+	std::scoped_lock lock { _mutex };
+
+	return _queue.size();
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,99 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Limits the number of connection attempts that may be in progress at the same time across all I/O components.
+///
+/// Connection attempts that cannot be started right away are queued, and are granted in the order in which they were
+/// first requested. Requesting a slot never blocks, so the caller must simply try again later if no slot was granted.
+/// Waiters that stop trying for longer than their stale timeout are removed from the queue, so that they do not block the
+/// waiters behind them. They are queued again at the back if they try again later. Each waiter has a stale timeout of its
+/// own, because clients may try again at very different intervals.
+class ReconnectGovernor final
+{
+public:
+	/// @brief An object representing a single client of the governor.
+	///
+	/// Each client must use its own waiter object, and must withdraw it before it is destroyed.
+	class Waiter final
+	{
+	public:
+		/// @brief The default stale timeout
+		static constexpr std::chrono::seconds kDefaultStaleTimeout { 10 };
+
+		/// @brief Sets how long the waiter may go without asking for permission before it is removed from the queue.
+		///
+		/// This must be well above the interval at which the client asks for permission.
+		/// @note This must not be called while the waiter is queued.
+		auto setStaleTimeout(std::chrono::steady_clock::duration staleTimeout) noexcept -> void
+		{
+			_staleTimeout = staleTimeout;
+		}
+
+	private:
+		/// @brief The governor needs access to the private members
+		friend class ReconnectGovernor;
+
+		/// @brief How long the waiter may go without asking for permission before it is removed from the queue
+		std::chrono::steady_clock::duration _staleTimeout { kDefaultStaleTimeout };
+		/// @brief Whether the waiter is currently in the queue
+		bool _queued { false };
+		/// @brief The time the waiter was added to the queue
+		std::chrono::steady_clock::time_point _enqueueTime;
+		/// @brief The last time the waiter asked for permission
+		std::chrono::steady_clock::time_point _pollTime;
+	};
+
+	/// @brief Information about a granted connection attempt
+	struct Grant final
+	{
+		/// @brief How long the client waited in the queue
+		std::chrono::nanoseconds _waitTime { 0 };
+		/// @brief The number of clients that remained in the queue
+		std::size_t _queueDepth { 0 };
+	};
+
+	/// @brief Constructor
+	/// @param maxConcurrentAttempts The maximum number of connection attempts that may be in progress at the same time
+	explicit ReconnectGovernor(std::size_t maxConcurrentAttempts) : _maxConcurrentAttempts(maxConcurrentAttempts)
+	{
+	}
+
+	/// @brief Requests permission to start a connection attempt.
+	///
+	/// If the permission is not granted, the waiter stays queued and keeps its place. Each granted attempt must be balanced
+	/// by a call to release().
+	/// @param waiter The waiter object of the client
+	/// @return Information about the grant, or std::nullopt if the client must try again later
+	auto tryAcquire(Waiter &waiter) -> std::optional<Grant>;
+
+	/// @brief Signals that a granted connection attempt has completed
+	auto release() -> void;
+
+	/// @brief Removes a waiter from the queue, if it is queued
+	auto withdraw(Waiter &waiter) -> void;
+
+	/// @brief Gets the number of waiters currently in the queue
+	auto queueDepth() const -> std::size_t;
+
+private:
+	/// @brief The maximum number of connection attempts that may be in progress at the same time
+	std::size_t _maxConcurrentAttempts;
+
+	/// @brief A mutex protecting the members below
+	mutable std::mutex _mutex;
+	/// @brief The number of connection attempts currently in progress
+	std::size_t _attemptsInProgress { 0 };
+	/// @brief The waiters, in the order in which they were queued
+	std::deque<Waiter *> _queue;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
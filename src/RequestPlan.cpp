@@ -0,0 +1,45 @@
+// Copyright (c) embedded ocean GmbH
+#include "RequestPlan.hpp"
+
+#include <algorithm>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto RequestPlan::compute(std::span<const AddressRange> ranges, std::uint32_t maxGap, std::uint32_t maxBlockSize) -> void
+{
+	_blocks.clear();
+	_largestBlockSize = 0;
+
+	for (std::size_t index = 0; index < ranges.size(); ++index)
+	{
+		const auto &range = ranges[index];
+
+		// Try to add the range to the current block
+		if (!_blocks.empty())
+		{
+			auto &block = _blocks.back();
+
+			// Use 64 bit arithmetic, so that ranges at the end of the address space cannot overflow
+			const auto blockEnd = std::uint64_t(block._address) + block._size;
+			const auto rangeEnd = std::uint64_t(range._address) + range._size;
+			const auto gap = range._address > blockEnd ? range._address - blockEnd : 0;
+			const auto newSize = std::max(blockEnd, rangeEnd) - block._address;
+
+			// Merge the range if the gap is small enough, and the block does not get too large
+			if (gap <= maxGap && newSize <= maxBlockSize)
+			{
+				block._size = std::uint32_t(newSize);
+				block._end = index + 1;
+				_largestBlockSize = std::max(_largestBlockSize, block._size);
+				continue;
+			}
+		}
+
+		// Start a new block
+		_blocks.push_back({ range._address, range._size, index, index + 1 });
+		_largestBlockSize = std::max(_largestBlockSize, range._size);
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,77 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief A range of consecutive addresses on the device
+/// @todo use the address format of the device
+struct AddressRange final
+{
+	/// @brief The first address
+	std::uint32_t _address { 0 };
+	/// @brief The number of address units
+	std::uint32_t _size { 1 };
+};
+
+/// @brief A precomputed plan that covers a set of address ranges with as few block requests as possible.
+///
+/// The plan is computed once, and can then be used any number of times without sorting or allocating memory.
+/// Recomputing the plan reuses the memory of the previous plan, so a plan that was reserved for enough blocks
+/// can be recomputed without allocating memory.
+class RequestPlan final
+{
+public:
+	/// @brief A single block request
+	struct Block final
+	{
+		/// @brief The first address of the block
+		std::uint32_t _address { 0 };
+		/// @brief The number of address units in the block
+		std::uint32_t _size { 0 };
+		/// @brief The index of the first address range covered by this block
+		std::size_t _begin { 0 };
+		/// @brief The index one past the last address range covered by this block
+		std::size_t _end { 0 };
+	};
+
+	/// @brief Reserves memory for a number of blocks
+	/// @param blockCount The largest number of blocks the plan will ever contain. A plan can never contain more blocks
+	/// than the number of address ranges it is computed from.
+	auto reserve(std::size_t blockCount) -> void
+	{
+		_blocks.reserve(blockCount);
+	}
+
+	/// @brief Computes the plan
+	/// @param ranges The address ranges to cover. The ranges must be sorted by address.
+	/// @param maxGap The largest number of unused address units that may be included in a block to merge neighbouring ranges
+	/// @param maxBlockSize The maximum number of address units a single block may contain. Ranges that are larger than
+	/// this on their own get a block of their own.
+	auto compute(std::span<const AddressRange> ranges, std::uint32_t maxGap, std::uint32_t maxBlockSize) -> void;
+
+	/// @brief Gets the blocks
+	auto blocks() const noexcept -> std::span<const Block>
+	{
+		return _blocks;
+	}
+
+	/// @brief Gets the size of the largest block, in address units
+	auto largestBlockSize() const noexcept -> std::uint32_t
+	{
+		return _largestBlockSize;
+	}
+
+private:
+	/// @brief The blocks, in order of ascending addresses
+	std::vector<Block> _blocks;
+	/// @brief The size of the largest block
+	std::uint32_t _largestBlockSize { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
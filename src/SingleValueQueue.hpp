@@ -3,18 +3,200 @@
 
 #include <xentara/utils/atomic/Optional.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
 namespace xentara::plugins::templateDriver
 {
 
+/// @brief Checks whether values of a type can be stored in a SingleValueQueue
+template <typename DataType>
+concept QueueableValue =
+	std::is_default_constructible_v<DataType> && std::is_nothrow_swappable_v<DataType> && std::is_nothrow_move_constructible_v<DataType>;
+
+/// @brief Checks whether values of a type can be stored in a lock-free utils::atomic::Optional
+template <typename DataType>
+concept LockFreeOptional =
+	QueueableValue<DataType> && std::is_trivially_copyable_v<DataType> && utils::atomic::Optional<DataType>::is_always_lock_free;
+
 /// @brief A thread-safe, lock-free queue that can hold a single value.
 ///
 /// This queues only allows enqueuing a single value. Enqueuing a second value will overwrite the first.
-template <typename DataType>
+///
+/// This is the general version for types that do not fit into a lock-free atomic. Values are stored in a triple buffer,
+/// which is allocated together with the queue, so enqueuing never allocates memory for the queue itself. At any time, one
+/// buffer belongs to the writer, one holds the latest value, and one belongs to the reader. The writer swaps the new value
+/// into its buffer, and then exchanges it with the latest one. The reader exchanges its buffer with the latest one when it
+/// dequeues. Neither ever waits for the other.
+///
+/// Only one thread at a time can own the writer's buffer. Each value is tagged with a sequence number when enqueuing starts,
+/// and a value is only published if no value with a higher sequence number was published before it, so the newest value
+/// always wins. A thread that finds another thread enqueuing waits until either it gets the writer's buffer, or a newer value
+/// was published, in which case its own value has been replaced, just as if it had been published first. The waiting only
+/// ever covers a swap and an exchange of another thread.
+///
+/// Dequeuing and restoring a value are serialized with each other using a spin lock. This never waits for a writer, only for
+/// another thread that is dequeuing or restoring a value itself, which takes a constant time.
+template <QueueableValue DataType>
 class SingleValueQueue final
 {
 public:
 	/// @brief Enqueues a value.
-	/// 
+	///
+	/// Any value already in the queue will be replaced. If another thread enqueues a newer value at the same time, and
+	/// publishes it first, the newer value replaces this one.
+	///
+	/// The value is passed by value, so that any copy is made by the caller, and is swapped into the queue, so enqueuing
+	/// itself never throws.
+	/// @param value The value to place in the queue
+	auto enqueue(DataType value) noexcept -> void
+	{
+		// Tag the value, so that an older value can never replace it
+		const auto sequence = _nextSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+
+		// Take ownership of the writer's buffer. We stop waiting if a newer value was published in the meantime, because
+		// that value replaces ours anyway.
+		while (_writing.test_and_set(std::memory_order_acquire))
+		{
+			if (_publishedSequence.load(std::memory_order_relaxed) > sequence)
+			{
+				return;
+			}
+			std::this_thread::yield();
+		}
+
+		// Only publish the value if no newer value was published while we were waiting
+		if (_publishedSequence.load(std::memory_order_relaxed) < sequence)
+		{
+			// Swap the value into the writer's buffer. Whatever stale value the buffer still held is destroyed together
+			// with the parameter.
+			using std::swap;
+			swap(_buffers[_writerBuffer], value);
+
+			// Make the buffer the latest one, and take over the previous latest buffer in exchange
+			const auto previous = _latest.exchange(_writerBuffer | kFresh, std::memory_order_acq_rel);
+			_writerBuffer = previous & kIndexMask;
+			_publishedSequence.store(sequence, std::memory_order_relaxed);
+		}
+
+		_writing.clear(std::memory_order_release);
+	}
+
+	/// @brief Puts back a value that was dequeued, unless a newer value was enqueued in the meantime
+	/// @param value The value to place back in the queue
+	auto restore(DataType value) noexcept -> void
+	{
+		// The reader's buffer holds the value while it is put back
+		lockReader();
+
+		// Only put the value back if there is no newer value already
+		auto expected = _latest.load(std::memory_order_relaxed);
+		if ((expected & kFresh) == 0)
+		{
+			// Swap the value into the reader's buffer, and exchange it with the latest one, but only if no writer made
+			// a newer value the latest one in the meantime.
+			using std::swap;
+			swap(_buffers[_readerBuffer], value);
+			if (_latest.compare_exchange_strong(expected, _readerBuffer | kFresh, std::memory_order_acq_rel, std::memory_order_relaxed))
+			{
+				_readerBuffer = expected & kIndexMask;
+			}
+		}
+
+		unlockReader();
+	}
+
+	/// @brief Gets the last scheduled value and removes it from the queue
+	/// @return The scheduled value or std::nullopt if none was scheduled since the last call
+	auto dequeue() noexcept -> std::optional<DataType>
+	{
+		// Check for a value first, so that dequeuing from an empty queue does not write to any shared memory
+		if (empty())
+		{
+			return std::nullopt;
+		}
+
+		lockReader();
+
+		// Exchange the reader's buffer with the latest one. Only the reader clears the fresh flag, so the latest value
+		// cannot have been taken by anyone else since we checked, but a writer may have replaced it with a newer one.
+		std::optional<DataType> value;
+		if (!empty())
+		{
+			const auto previous = _latest.exchange(_readerBuffer, std::memory_order_acq_rel);
+			_readerBuffer = previous & kIndexMask;
+			value.emplace(std::move(_buffers[_readerBuffer]));
+		}
+
+		unlockReader();
+		return value;
+	}
+
+	/// @brief Checks whether the queue is empty
+	/// @note The result is only a snapshot if other threads are using the queue at the same time.
+	auto empty() const noexcept -> bool
+	{
+		return (_latest.load(std::memory_order_relaxed) & kFresh) == 0;
+	}
+
+private:
+	/// @brief Takes ownership of the reader's buffer.
+	///
+	/// This only waits for another thread that is dequeuing or restoring a value, never for a writer.
+	auto lockReader() noexcept -> void
+	{
+		while (_reading.test_and_set(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	/// @brief Gives up ownership of the reader's buffer
+	auto unlockReader() noexcept -> void
+	{
+		_reading.clear(std::memory_order_release);
+	}
+
+	/// @brief The bits of _latest that contain the index of the buffer
+	static constexpr std::uint32_t kIndexMask = 0x3;
+	/// @brief The bit of _latest that is set if the latest buffer contains a value that was not dequeued yet
+	static constexpr std::uint32_t kFresh = 0x4;
+
+	/// @brief The buffers
+	std::array<DataType, 3> _buffers {};
+	/// @brief The index of the latest buffer, plus kFresh if it contains a value that was not dequeued yet
+	std::atomic<std::uint32_t> _latest { 1 };
+	/// @brief Set while a thread owns the writer's buffer
+	std::atomic_flag _writing;
+	/// @brief The index of the writer's buffer. Only accessed by the thread that set _writing.
+	std::uint32_t _writerBuffer { 0 };
+	/// @brief The sequence number of the last value that was enqueued
+	std::atomic<std::uint64_t> _nextSequence { 0 };
+	/// @brief The sequence number of the last value that was published. Only written by the thread that set _writing.
+	std::atomic<std::uint64_t> _publishedSequence { 0 };
+	/// @brief Set while a thread owns the reader's buffer
+	std::atomic_flag _reading;
+	/// @brief The index of the reader's buffer. Only accessed by the thread that set _reading.
+	std::uint32_t _readerBuffer { 2 };
+};
+
+/// @brief A thread-safe, lock-free queue that can hold a single value.
+///
+/// This queues only allows enqueuing a single value. Enqueuing a second value will overwrite the first.
+///
+/// This is the version for types that fit into a lock-free atomic. Such values are stored directly in an atomic,
+/// which makes both enqueuing and dequeuing wait-free.
+template <LockFreeOptional DataType>
+class SingleValueQueue<DataType> final
+{
+public:
+	/// @brief Enqueues a value.
+	///
 	/// Any value already in the queue will be replaced.
 	/// @param value The value to place in the queue
 	auto enqueue(const DataType &value) noexcept -> void
@@ -22,6 +204,14 @@ public:
 		_value.store(value, std::memory_order_release);
 	}
 
+	/// @brief Puts back a value that was dequeued, unless a newer value was enqueued in the meantime
+	/// @param value The value to place back in the queue
+	auto restore(const DataType &value) noexcept -> void
+	{
+		std::optional<DataType> expected;
+		_value.compare_exchange_strong(expected, value, std::memory_order_acq_rel, std::memory_order_relaxed);
+	}
+
 	/// @brief Gets the last scheduled value and removes it from the queue
 	/// @return The scheduled value or std::nullopt if none was scheduled since the last call
 	auto dequeue() noexcept -> std::optional<DataType>
@@ -29,12 +219,16 @@ public:
 		return _value.exchange(std::nullopt, std::memory_order_acq_rel);
 	}
 
+	/// @brief Checks whether the queue is empty
+	/// @note The result is only a snapshot if other threads are using the queue at the same time.
+	auto empty() const noexcept -> bool
+	{
+		return !_value.load(std::memory_order_relaxed).has_value();
+	}
+
 private:
 	/// @brief The queued value, or std::nullopt if the queue is empty.
 	utils::atomic::Optional<DataType> _value;
-
-	// Check that the value is lock free, or blocking will occurr
-	static_assert(decltype(_value)::is_always_lock_free);
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -1,6 +1,7 @@
 // Copyright (c) embedded ocean GmbH
 #pragma once
 
+#include "ReconnectGovernor.hpp"
 #include "TemplateIoComponent.hpp"
 #include "TemplateOutput.hpp"
 #include "TemplateInput.hpp"
@@ -8,6 +9,7 @@
 #include <xentara/skill/Skill.hpp>
 #include <xentara/utils/core/Uuid.hpp>
 
+#include <cstddef>
 #include <string_view>
 
 namespace xentara::plugins::templateDriver
@@ -34,6 +36,10 @@ public:
 	/// @}
 
 private:
+	/// @brief The maximum number of connection attempts that may be in progress at the same time across all I/O components
+	/// @todo adjust this to the capabilities of the network and the devices
+	static constexpr std::size_t kMaxConcurrentConnectionAttempts = 16;
+
 	/// @brief The skill class
 	/// @todo change class name
 	/// @todo assign a unique UUID
@@ -46,6 +52,9 @@ private:
 
 	/// @brief The skill class object
 	static Class _class;
+
+	/// @brief The governor that limits the number of concurrent connection attempts of all I/O components
+	ReconnectGovernor _reconnectGovernor { kMaxConcurrentConnectionAttempts };
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Copyright (c) embedded ocean GmbH
+#include "TaskMonitor.hpp"
+
+#include "Attributes.hpp"
+#include "Events.hpp"
+
+#include <xentara/memory/memoryResources.hpp>
+#include <xentara/memory/WriteSentinel.hpp>
+
+#include <algorithm>
+
+namespace xentara::plugins::templateDriver
+{
+
+const TaskMonitor::Roles TaskMonitor::kReadRoles {
+	attributes::kReadTaskOverruns, attributes::kReadTaskMaxLateness, attributes::kReadTaskMaxDuration, events::kReadTaskOverrun
+};
+
+const TaskMonitor::Roles TaskMonitor::kWriteRoles {
+	attributes::kWriteTaskOverruns, attributes::kWriteTaskMaxLateness, attributes::kWriteTaskMaxDuration, events::kWriteTaskOverrun
+};
+
+const TaskMonitor::Roles TaskMonitor::kReconnectRoles {
+	attributes::kReconnectTaskOverruns, attributes::kReconnectTaskMaxLateness, attributes::kReconnectTaskMaxDuration, events::kReconnectTaskOverrun
+};
+
+const TaskMonitor::Roles TaskMonitor::kBatchReadRoles {
+	attributes::kBatchReadTaskOverruns, attributes::kBatchReadTaskMaxLateness, attributes::kBatchReadTaskMaxDuration, events::kBatchReadTaskOverrun
+};
+
+const TaskMonitor::Roles TaskMonitor::kBatchWriteRoles {
+	attributes::kBatchWriteTaskOverruns, attributes::kBatchWriteTaskMaxLateness, attributes::kBatchWriteTaskMaxDuration, events::kBatchWriteTaskOverrun
+};
+
+const TaskMonitor::Roles TaskMonitor::kFlushTraceRoles {
+	attributes::kFlushTraceTaskOverruns, attributes::kFlushTraceTaskMaxLateness, attributes::kFlushTraceTaskMaxDuration, events::kFlushTraceTaskOverrun
+};
+
+const TaskMonitor::Roles TaskMonitor::kPublishStatisticsRoles {
+	attributes::kPublishStatisticsTaskOverruns, attributes::kPublishStatisticsTaskMaxLateness, attributes::kPublishStatisticsTaskMaxDuration, events::kPublishStatisticsTaskOverrun
+};
+
+auto TaskMonitor::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
+{
+	// Handle all the attributes we support
+	return
+		function(_roles._overruns) ||
+		function(_roles._maxLateness) ||
+		function(_roles._maxDuration);
+}
+
+auto TaskMonitor::forEachEvent(const model::ForEachEventFunction &function, std::shared_ptr<void> parent) -> bool
+{
+	// Handle all the events we support
+	return
+		function(_roles._overrunEvent, std::shared_ptr<process::Event>(parent, &_overrunEvent));
+}
+
+auto TaskMonitor::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	// Try each readable attribute
+	if (attribute == _roles._overruns)
+	{
+		return _dataBlock.member(&State::_overruns);
+	}
+	else if (attribute == _roles._maxLateness)
+	{
+		return _dataBlock.member(&State::_maxLateness);
+	}
+	else if (attribute == _roles._maxDuration)
+	{
+		return _dataBlock.member(&State::_maxDuration);
+	}
+
+	return std::nullopt;
+}
+
+auto TaskMonitor::realize() -> void
+{
+	// Create the data block
+	_dataBlock.create(memory::memoryResources::data());
+}
+
+auto TaskMonitor::start(std::chrono::system_clock::time_point scheduledTime) noexcept -> Execution
+{
+	Execution execution;
+	execution._scheduledTime = scheduledTime;
+
+	// Derive the period from the previous execution. The first execution has no previous one, and if the scheduled time
+	// did not advance, the task was executed again out of turn, e.g. in a different stage.
+	if (_lastScheduledTime != std::chrono::system_clock::time_point() && execution._scheduledTime > _lastScheduledTime)
+	{
+		execution._period = execution._scheduledTime - _lastScheduledTime;
+	}
+	_lastScheduledTime = execution._scheduledTime;
+
+	// A task can never start early, so negative lateness can only be caused by clock adjustments
+	execution._lateness = std::max<std::chrono::nanoseconds>(std::chrono::system_clock::now() - execution._scheduledTime, {});
+
+	execution._startTime = std::chrono::steady_clock::now();
+	return execution;
+}
+
+auto TaskMonitor::finish(const Execution &execution) -> void
+{
+	const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - execution._startTime;
+	const auto overrun = execution._period.count() > 0 && duration > execution._period;
+
+	// Most executions are neither overruns nor set a new maximum, so they need not write the data block
+	if (!overrun && execution._lateness <= _maxLateness && duration <= _maxDuration)
+	{
+		return;
+	}
+
+	// Update the maximums
+	_maxLateness = std::max(execution._lateness, _maxLateness);
+	_maxDuration = std::max(duration, _maxDuration);
+
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+	auto &state = *sentinel;
+	const auto &oldState = sentinel.oldValue();
+
+	// Update the state. We must write all the members, because memory resources use swap-in.
+	state._overruns = oldState._overruns + (overrun ? 1 : 0);
+	state._maxLateness = _maxLateness;
+	state._maxDuration = _maxDuration;
+
+	// Commit the data, and raise the event if this was an overrun
+	const auto timeStamp = std::chrono::system_clock::now();
+	if (overrun)
+	{
+		sentinel.commit(timeStamp, _overrunEvent);
+	}
+	else
+	{
+		sentinel.commit(timeStamp);
+	}
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
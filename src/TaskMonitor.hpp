@@ -0,0 +1,141 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/memory/ObjectBlock.hpp>
+#include <xentara/model/Attribute.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+#include <xentara/model/ForEachEventFunction.hpp>
+#include <xentara/process/Event.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Monitors the timing of a single task of an element.
+///
+/// The monitor records how late each task execution started relative to its scheduled time, and how long it took.
+/// An execution that takes longer than the period of the task is an overrun. The period is taken from the difference
+/// between the scheduled times of two consecutive executions of the task.
+///
+/// Each task has its own monitor, with its own attributes and event, so that the figures of the different tasks of an
+/// element can be told apart. Because the executions of a task never overlap, the monitor is never used by two threads
+/// at the same time.
+class TaskMonitor final
+{
+public:
+	/// @brief The attributes and the event of a monitor, which are specific to the task it monitors
+	struct Roles final
+	{
+		/// @brief The attribute containing the number of overruns
+		const model::Attribute &_overruns;
+		/// @brief The attribute containing the largest lateness
+		const model::Attribute &_maxLateness;
+		/// @brief The attribute containing the longest duration
+		const model::Attribute &_maxDuration;
+		/// @brief The event that is raised on an overrun
+		const process::Event::Role &_overrunEvent;
+	};
+
+	/// @brief The roles for the "read" task of a data point
+	static const Roles kReadRoles;
+	/// @brief The roles for the "write" task of a data point
+	static const Roles kWriteRoles;
+	/// @brief The roles for the "reconnect" task of an I/O component
+	static const Roles kReconnectRoles;
+	/// @brief The roles for the "batchRead" task of an I/O component
+	static const Roles kBatchReadRoles;
+	/// @brief The roles for the "batchWrite" task of an I/O component
+	static const Roles kBatchWriteRoles;
+	/// @brief The roles for the "flushTrace" task of an I/O component
+	static const Roles kFlushTraceRoles;
+	/// @brief The roles for the "publishStatistics" task of an I/O component
+	static const Roles kPublishStatisticsRoles;
+
+	/// @brief Timing information about a task execution in progress
+	struct Execution final
+	{
+		/// @brief The time the execution was scheduled for
+		std::chrono::system_clock::time_point _scheduledTime;
+		/// @brief The period of the task, or 0 if it is not known yet
+		std::chrono::nanoseconds _period { 0 };
+		/// @brief How late the execution started
+		std::chrono::nanoseconds _lateness { 0 };
+		/// @brief The time the execution started
+		std::chrono::steady_clock::time_point _startTime;
+	};
+
+	/// @brief Constructor
+	/// @param roles The attributes and the event of the task the monitor is for
+	explicit TaskMonitor(const Roles &roles) noexcept : _roles(roles)
+	{
+	}
+
+	/// @brief Iterates over all the attributes that belong to the monitor.
+	/// @param function The function that should be called for each attribute
+	/// @return The return value of the last function call
+	auto forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool;
+
+	/// @brief Iterates over all the events that belong to the monitor.
+	/// @param function The function that should be called for each events
+	/// @param parent
+	/// @parblock
+	/// A shared pointer to the containing object.
+	/// 
+	/// The pointer is used in the aliasing constructor of std::shared_ptr when constructing the event pointers,
+	/// so that they will share ownership information with pointers to the parent object.
+	/// @endparblock
+	/// @return The return value of the last function call
+	auto forEachEvent(const model::ForEachEventFunction &function, std::shared_ptr<void> parent) -> bool;
+
+	/// @brief Creates a read-handle for an attribute that belong to the monitor.
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+
+	/// @brief Realizes the monitor
+	auto realize() -> void;
+
+	/// @brief Must be called at the start of a task execution
+	/// @param scheduledTime The time the execution was scheduled for
+	/// @return The information that must be passed to finish()
+	auto start(std::chrono::system_clock::time_point scheduledTime) noexcept -> Execution;
+
+	/// @brief Must be called at the end of a task execution
+	/// @param execution The information returned by start()
+	auto finish(const Execution &execution) -> void;
+
+private:
+	/// @brief This structure is used to represent the state inside the memory block
+	struct State final
+	{
+		/// @brief The number of task executions that took longer than the period
+		std::uint64_t _overruns { 0 };
+		/// @brief The largest delay with which a task execution started
+		std::chrono::nanoseconds _maxLateness { 0 };
+		/// @brief The longest time a task execution took
+		std::chrono::nanoseconds _maxDuration { 0 };
+	};
+
+	/// @brief The attributes and the event of the task
+	const Roles &_roles;
+
+	/// @brief The scheduled time of the last execution, used to determine the period
+	std::chrono::system_clock::time_point _lastScheduledTime;
+	/// @brief The largest lateness recorded so far, so that the data block is only written for new maximums and overruns
+	std::chrono::nanoseconds _maxLateness { 0 };
+	/// @brief The longest duration recorded so far, so that the data block is only written for new maximums and overruns
+	std::chrono::nanoseconds _maxDuration { 0 };
+
+	/// @brief A Xentara event that is raised when a task execution took longer than the period
+	process::Event _overrunEvent;
+
+	/// @brief The data block that contains the state
+	memory::ObjectBlock<State> _dataBlock;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
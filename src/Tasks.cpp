@@ -17,4 +17,16 @@ const process::Task::Role kRead { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "
 /// @todo assign a unique UUID
 const process::Task::Role kWrite { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "write"sv };
 
+/// @todo assign a unique UUID
+const process::Task::Role kBatchRead { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchRead"sv };
+
+/// @todo assign a unique UUID
+const process::Task::Role kBatchWrite { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "batchWrite"sv };
+
+/// @todo assign a unique UUID
+const process::Task::Role kFlushTrace { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "flushTrace"sv };
+
+/// @todo assign a unique UUID
+const process::Task::Role kPublishStatistics { "deadbeef-dead-beef-dead-beefdeadbeef"_uuid, "publishStatistics"sv };
+
 } // namespace xentara::plugins::templateDriver::tasks
\ No newline at end of file
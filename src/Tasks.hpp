@@ -11,5 +11,13 @@ namespace xentara::plugins::templateDriver::tasks
 extern const process::Task::Role kRead;
 /// @brief A Xentara task used to write a data point
 extern const process::Task::Role kWrite;
+/// @brief A Xentara task used to read all the data points of an I/O component in a batch
+extern const process::Task::Role kBatchRead;
+/// @brief A Xentara task used to write all the pending values of the data points of an I/O component in a batch
+extern const process::Task::Role kBatchWrite;
+/// @brief A Xentara task used to write the recorded trace spans of an I/O component and its data points to a file
+extern const process::Task::Role kFlushTrace;
+/// @brief A Xentara task used to publish the statistics of an I/O component and its data points
+extern const process::Task::Role kPublishStatistics;
 
 } // namespace xentara::plugins::templateDriver::tasks
\ No newline at end of file
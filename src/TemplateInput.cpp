@@ -25,11 +25,61 @@ const model::Attribute TemplateInput::kValueAttribute { model::Attribute::kValue
 
 auto TemplateInput::load(utils::json::decoder::Object &jsonObject, config::Context &context) -> void
 {
+	// Keep track of which mandatory parameters were found
+	bool addressLoaded = false;
+
+	// The change filter is collected here, and set on the state afterwards
+	ReadState<double>::ChangeFilter changeFilter;
+	// The report by exception settings are also collected here
+	bool reportByException = false;
+	std::chrono::nanoseconds heartbeatInterval { 0 };
+
 	// Go through all the members of the JSON object that represents this object
 	for (auto && [name, value] : jsonObject)
     {
+		if (name == "address"sv)
+		{
+			_addressRange._address = value.asNumber<std::uint32_t>();
+			addressLoaded = true;
+		}
+		else if (name == "splitPhaseRead"sv)
+		{
+			_splitPhaseRead = value.asBool();
+		}
+		else if (name == "reportByException"sv)
+		{
+			reportByException = value.asBool();
+		}
+		else if (name == "heartbeatInterval"sv)
+		{
+			heartbeatInterval = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+		}
+		else if (name == "deadband"sv)
+		{
+			changeFilter._absoluteDeadband = value.asNumber<double>();
+
+			// A negative deadband makes no sense
+			if (changeFilter._absoluteDeadband < 0.0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("deadband of template input must not be negative"));
+			}
+		}
+		else if (name == "percentDeadband"sv)
+		{
+			changeFilter._percentDeadband = value.asNumber<double>();
+
+			// A negative deadband makes no sense
+			if (changeFilter._percentDeadband < 0.0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("percent deadband of template input must not be negative"));
+			}
+		}
+		else if (name == "minChangeInterval"sv)
+		{
+			changeFilter._minChangeInterval = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+		}
 		/// @todo load configuration parameters
-		if (name == "TODO"sv)
+		else if (name == "TODO"sv)
 		{
 			/// @todo parse the value correctly
 			auto todo = value.asNumber<std::uint64_t>();
@@ -49,6 +99,17 @@ auto TemplateInput::load(utils::json::decoder::Object &jsonObject, config::Conte
 		}
     }
 
+	// Check that the address was specified
+	if (!addressLoaded)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing address in template input"));
+	}
+
+	// Set the change filter
+	_state.setChangeFilter(changeFilter);
+	// Set the report by exception settings
+	_state.setReportByException(reportByException, heartbeatInterval);
+
 	/// @todo perform consistency and completeness checks
 	if (!"TODO")
 	{
@@ -57,29 +118,47 @@ auto TemplateInput::load(utils::json::decoder::Object &jsonObject, config::Conte
 	}
 }
 
-auto TemplateInput::performReadTask(const process::ExecutionContext &context) -> void
+auto TemplateInput::performRead(std::chrono::system_clock::time_point timeStamp) -> void
 {
-	// Only perform the reconnect if we are supposed to be connected in the first place
+	// Only perform the read if the I/O component is connected
 	if (!_ioComponent.get().connected())
 	{
 		return;
 	}
 
+	// For split-phase reads, collect the response to the request sent in the last cycle, and send the request for the next one
+	if (_splitPhaseRead)
+	{
+		if (_readRequestPending.load(std::memory_order_acquire))
+		{
+			receiveReadResponse();
+		}
+		// Don't send the next request if the response showed that the connection was lost
+		if (!_ioComponent.get().connected())
+		{
+			return;
+		}
+		sendReadRequest(timeStamp);
+		return;
+	}
+
 	// Read the data
-	read(context.scheduledTime());
+	read(timeStamp);
 }
 
 auto TemplateInput::read(std::chrono::system_clock::time_point timeStamp) -> void
 {
+	Tracer::Span span { _ioComponent.get().tracer(), "read"sv };
+
 	try
 	{
-		/// @todo read the value
-		double value = {};
+		const auto requestTime = std::chrono::steady_clock::now();
 
-		/// @todo if the read function does not throw errors, but uses return types or internal handle state,
-		// throw an std::system_error here on failure, or call handleReadError() directly.
+		// Read the value
+		const auto value = _ioComponent.get().handle().read(_addressRange);
 
 		// The read was successful
+		_ioComponent.get().statistics().recordRead(std::chrono::steady_clock::now() - requestTime);
 		_state.update(timeStamp, value);
 	}
 	catch (const std::exception &)
@@ -91,6 +170,54 @@ auto TemplateInput::read(std::chrono::system_clock::time_point timeStamp) -> voi
 	}
 }
 
+auto TemplateInput::sendReadRequest(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	try
+	{
+		_readRequestTime = std::chrono::steady_clock::now();
+
+		// Send the read request without waiting for the response
+		_ioComponent.get().handle().sendReadRequest(_addressRange);
+
+		// Remember to collect the response
+		_readRequestPending.store(true, std::memory_order_release);
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleReadError(timeStamp, error);
+	}
+}
+
+auto TemplateInput::receiveReadResponse() -> void
+{
+	// The request is no longer pending, whatever happens
+	_readRequestPending.store(false, std::memory_order_release);
+
+	try
+	{
+		/// @todo If your protocol library delivers responses asynchronously, you can also call this function from its completion
+		// handler instead of from performRead().
+		const auto value = _ioComponent.get().handle().receiveReadResponse(_addressRange);
+
+		/// @todo use the time stamp provided by the device, if the protocol has one
+		const auto responseTime = std::chrono::system_clock::now();
+
+		// The read was successful
+		_ioComponent.get().statistics().recordRead(std::chrono::steady_clock::now() - _readRequestTime);
+		_state.update(responseTime, value);
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleReadError(std::chrono::system_clock::now(), error);
+	}
+}
+
 auto TemplateInput::handleReadError(std::chrono::system_clock::time_point timeStamp, std::error_code error)
 	-> void
 {
@@ -117,7 +244,9 @@ auto TemplateInput::forEachAttribute(const model::ForEachAttributeFunction &func
 		function(kValueAttribute) ||
 
 		// Handle the state attributes
-		_state.forEachAttribute(function);
+		_state.forEachAttribute(function) ||
+		// Handle the task monitor attributes
+		_readTask.monitor().forEachAttribute(function);
 
 	/// @todo handle any additional attributes this class supports, including attributes inherited from the I/O component
 }
@@ -126,7 +255,9 @@ auto TemplateInput::forEachEvent(const model::ForEachEventFunction &function) ->
 {
 	return
 		// Handle the state events
-		_state.forEachEvent(function, sharedFromThis());
+		_state.forEachEvent(function, sharedFromThis()) ||
+		// Handle the task monitor events
+		_readTask.monitor().forEachEvent(function, sharedFromThis());
 
 	/// @todo handle any additional events this class supports, including events inherited from the I/O component
 }
@@ -153,6 +284,11 @@ auto TemplateInput::makeReadHandle(const model::Attribute &attribute) const noex
 	{
 		return handle;
 	}
+	// Handle the task monitor attributes
+	if (auto handle = _readTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
 
 	/// @todo handle any additional readable attributes this class supports, including attributes inherited from the I/O component
 
@@ -161,8 +297,10 @@ auto TemplateInput::makeReadHandle(const model::Attribute &attribute) const noex
 
 auto TemplateInput::realize() -> void
 {
-	// Realize the state object
+	// Realize the state objects
+	_state.setTracer(_ioComponent.get().tracer());
 	_state.realize();
+	_readTask.monitor().realize();
 }
 
 auto TemplateInput::ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
@@ -170,8 +308,32 @@ auto TemplateInput::ioComponentStateChanged(std::chrono::system_clock::time_poin
 	// We cannot reset the error to Ok because we don't have a value. So we use the special custom error code instead.
 	auto effectiveError = error ? error : CustomError::NoData;
 
+	// Any split-phase read request that was sent before is lost
+	_readRequestPending.store(false, std::memory_order_release);
+
 	// Update the state. We do not notify the I/O component, because that is who this message comes from in the first place.
 	_state.update(timeStamp, utils::eh::unexpected(effectiveError));
 }
 
+auto TemplateInput::ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp,
+	std::error_code error,
+	process::DynamicEventList &events) -> void
+{
+	// We cannot reset the error to Ok because we don't have a value. So we use the special custom error code instead.
+	auto effectiveError = error ? error : CustomError::NoData;
+
+	// Any split-phase read request that was sent before is lost
+	_readRequestPending.store(false, std::memory_order_release);
+
+	// Update the state, leaving the events to the I/O component
+	_state.update(timeStamp, utils::eh::unexpected(effectiveError), events);
+}
+
+auto TemplateInput::batchReadCompleted(std::chrono::system_clock::time_point timeStamp,
+	const utils::eh::expected<double, std::error_code> &valueOrError) -> void
+{
+	// Update the state. The I/O component has already handled any errors that affect it.
+	_state.update(timeStamp, valueOrError);
+}
+
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -4,11 +4,13 @@
 #include "TemplateIoComponent.hpp"
 #include "ReadState.hpp"
 #include "ReadTask.hpp"
+#include "TaskMonitor.hpp"
 
 #include <xentara/process/Task.hpp>
 #include <xentara/skill/DataPoint.hpp>
 #include <xentara/skill/EnableSharedFromThis.hpp>
 
+#include <atomic>
 #include <functional>
 #include <string_view>
 
@@ -19,7 +21,11 @@ using namespace std::literals;
 
 /// @brief A class representing a specific type of input.
 /// @todo rename this class to something more descriptive
-class TemplateInput final : public skill::DataPoint, public TemplateIoComponent::ErrorSink, public skill::EnableSharedFromThis<TemplateInput>
+class TemplateInput final :
+	public skill::DataPoint,
+	public TemplateIoComponent::ErrorSink,
+	public TemplateIoComponent::ReadSink,
+	public skill::EnableSharedFromThis<TemplateInput>
 {
 public:
 	/// @brief The class object containing meta-information about this element type
@@ -33,6 +39,7 @@ public:
 		_ioComponent(ioComponent)
 	{
 		ioComponent.get().addErrorSink(*this);
+		ioComponent.get().addReadSink(*this);
 	}
 
 	/// @name Virtual Overrides for skill::DataPoint
@@ -57,6 +64,23 @@ public:
 	
 	auto ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void final;
 
+	auto ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp,
+		std::error_code error,
+		process::DynamicEventList &events) -> void final;
+
+	/// @}
+
+	/// @name Virtual Overrides for TemplateIoComponent::ReadSink
+	/// @{
+
+	auto addressRange() const noexcept -> AddressRange final
+	{
+		return _addressRange;
+	}
+
+	auto batchReadCompleted(std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<double, std::error_code> &valueOrError) -> void final;
+
 	/// @}
 
 	/// @brief A Xentara attribute containing the current value.
@@ -68,6 +92,12 @@ private:
 	/// @brief The read task needs access to out private member functions
 	friend class ReadTask<TemplateInput>;
 
+	/// @brief This function is forwarded to the I/O component.
+	auto ioWorker() noexcept -> IoWorker *
+	{
+		return _ioComponent.get().ioWorker();
+	}
+
 	/// @brief This function is forwarded to the I/O component.
 	auto requestConnect(std::chrono::system_clock::time_point timeStamp) noexcept -> void
 	{
@@ -80,12 +110,20 @@ private:
 		_ioComponent.get().requestDisconnect(timeStamp);
 	}
 
-	/// @brief This function is called by the "read" task.
+	/// @brief Attempts to read the value if the I/O component is up.
 	///
-	/// This function attempts to read the value if the I/O component is up.
-	auto performReadTask(const process::ExecutionContext &context) -> void;
+	/// This function is called either by the "read" task, or on the I/O thread of the I/O component.
+	auto performRead(std::chrono::system_clock::time_point timeStamp) -> void;
 	/// @brief Attempts to read the data from the I/O component and updates the state accordingly.
 	auto read(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Sends a read request to the I/O component without waiting for the response.
+	///
+	/// This is used for split-phase reads. The response is collected by receiveReadResponse() during the next cycle.
+	auto sendReadRequest(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Receives the response to a read request sent by sendReadRequest() and updates the state accordingly.
+	///
+	/// The state is updated using the time the response was received, rather than the time the request was scheduled.
+	auto receiveReadResponse() -> void;
 	/// @brief Handles a read error
 	auto handleReadError(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
 
@@ -102,12 +140,23 @@ private:
 	/// @todo give this a more descriptive name, e.g. "_device"
 	std::reference_wrapper<TemplateIoComponent> _ioComponent;
 
+	/// @brief Whether to use split-phase reads, where the request is sent in one cycle, and the response is collected in the next
+	bool _splitPhaseRead { false };
+	/// @brief Whether a split-phase read request was sent, and its response has not been collected yet
+	std::atomic<bool> _readRequestPending { false };
+	/// @brief The time the pending split-phase read request was sent. This is set before _readRequestPending.
+	std::chrono::steady_clock::time_point _readRequestTime;
+
+	/// @brief The device addresses of the input
+	/// @todo set the size to the number of address units occupied by the value type
+	AddressRange _addressRange;
+
 	/// @brief The state
 	/// @todo use the correct value type
 	ReadState<double> _state;
 
 	/// @brief The "read" task
-	ReadTask<TemplateInput> _readTask { *this };
+	ReadTask<TemplateInput> _readTask { *this, TaskMonitor::kReadRoles };
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Attributes.hpp"
 #include "TemplateInput.hpp"
 #include "TemplateOutput.hpp"
+#include "Tasks.hpp"
 
 #include <xentara/config/Errors.hpp>
 #include <xentara/data/ReadHandle.hpp>
@@ -20,7 +21,12 @@
 #include <xentara/utils/json/decoder/Object.hpp>
 #include <xentara/utils/json/decoder/Errors.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <string>
 #include <string_view>
+#include <utility>
 
 #ifdef _WIN32
 #	include <Windows.h>
@@ -33,6 +39,12 @@ namespace xentara::plugins::templateDriver
 
 using namespace std::literals;
 
+TemplateIoComponent::~TemplateIoComponent()
+{
+	// Make sure the governor does not keep a reference to our waiter
+	_reconnectGovernor.get().withdraw(_reconnectWaiter);
+}
+
 auto TemplateIoComponent::load(utils::json::decoder::Object &jsonObject, config::Context &context) -> void
 {
 	// Go through all the members of the JSON object that represents this object
@@ -53,12 +65,146 @@ auto TemplateIoComponent::load(utils::json::decoder::Object &jsonObject, config:
 
 			/// @todo set the appropriate member variables
 		}
+		else if (name == "asynchronousConnect"sv)
+		{
+			_asynchronousConnect = value.asBool();
+		}
+		else if (name == "ioThread"sv)
+		{
+			_useIoThread = value.asBool();
+		}
+		else if (name == "batchStateChanges"sv)
+		{
+			_batchStateChanges = value.asBool();
+		}
+		else if (name == "reconnectDelay"sv)
+		{
+			_reconnectDelay = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+		}
+		else if (name == "maxReconnectDelay"sv)
+		{
+			_maxReconnectDelay = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+		}
+		else if (name == "reconnectJitter"sv)
+		{
+			_reconnectJitter = value.asNumber<double>();
+
+			// The jitter is a fraction of the delay
+			if (_reconnectJitter < 0.0 || _reconnectJitter > 1.0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("reconnect jitter of template I/O component must be between 0 and 1"));
+			}
+		}
+		else if (name == "reconnectQueueTimeout"sv)
+		{
+			const auto timeout = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+
+			// A waiter with a timeout of 0 would lose its place in the queue right away
+			if (timeout == 0ms)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("reconnect queue timeout of template I/O component must not be 0"));
+			}
+
+			_reconnectWaiter.setStaleTimeout(timeout);
+		}
+		else if (name == "writeRate"sv)
+		{
+			_writeRate = value.asNumber<double>();
+
+			// A negative rate makes no sense
+			if (_writeRate < 0.0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("write rate of template I/O component must not be negative"));
+			}
+		}
+		else if (name == "writeBurst"sv)
+		{
+			_writeBurst = value.asNumber<double>();
+
+			// We must be able to send at least one request
+			if (_writeBurst < 1.0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("write burst of template I/O component must be at least 1"));
+			}
+		}
+		else if (name == "traceFile"sv)
+		{
+			_traceFile = value.asString<std::string>();
+
+			// We need a file name
+			if (_traceFile.empty())
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("trace file of template I/O component must not be empty"));
+			}
+		}
+		else if (name == "statisticsWindow"sv)
+		{
+			_statisticsWindow = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+
+			// The rates are computed by dividing by the window
+			if (_statisticsWindow == 0ms)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("statistics window of template I/O component must not be 0"));
+			}
+		}
+		else if (name == "maxOutstandingRequests"sv)
+		{
+			_maxOutstandingRequests = value.asNumber<std::size_t>();
+
+			// We need to be able to send at least one request
+			if (_maxOutstandingRequests == 0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum number of outstanding requests of template I/O component must not be 0"));
+			}
+			// The transaction IDs of the outstanding requests must not wrap around
+			if (_maxOutstandingRequests > TransactionWindow<ReadTransaction>::kMaxSize)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum number of outstanding requests of template I/O component must not exceed " +
+					std::to_string(TransactionWindow<ReadTransaction>::kMaxSize)));
+			}
+		}
+		else if (name == "batchReadTimeout"sv)
+		{
+			_batchReadTimeout = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+
+			// We need some time to receive the responses
+			if (_batchReadTimeout == 0ms)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("batch read timeout of template I/O component must not be 0"));
+			}
+		}
+		else if (name == "maxRequestGap"sv)
+		{
+			_maxRequestGap = value.asNumber<std::uint32_t>();
+		}
+		else if (name == "maxRequestSize"sv)
+		{
+			_maxRequestSize = value.asNumber<std::uint32_t>();
+
+			// A request must contain at least one address
+			if (_maxRequestSize == 0)
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("maximum request size of template I/O component must not be 0"));
+			}
+		}
 		else
 		{
             config::throwUnknownParameterError(name);
 		}
     }
 
+	// Create the tracer now rather than when realizing, so that it is available to the data points however the elements are ordered
+	if (!_traceFile.empty())
+	{
+		_tracer.emplace();
+	}
+
+	// Check that the reconnect delays are consistent
+	if (_maxReconnectDelay < _reconnectDelay)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("maximum reconnect delay of template I/O component is less than the reconnect delay"));
+	}
+
 	/// @todo perform consistency and completeness checks
 	if (!"TODO")
 	{
@@ -67,42 +213,604 @@ auto TemplateIoComponent::load(utils::json::decoder::Object &jsonObject, config:
 	}
 }
 
-auto TemplateIoComponent::performReconnectTask(const process::ExecutionContext &context) -> void
+auto TemplateIoComponent::performReconnectTask(const process::ExecutionContext &context) -> void
+{
+	// Pass any batched state change on to the error sinks, unless the I/O thread does that
+	const auto deliverStateChanges = _batchStateChanges && !_ioWorker;
+	if (deliverStateChanges)
+	{
+		deliverStateChange();
+	}
+
+	// Only perform the reconnect if we are supposed to be connected in the first place
+	if (_connectionRequestCount.load(std::memory_order_relaxed) == 0)
+	{
+		return;
+	}
+	// Also don't reconnect if we are already connected, or a connection attempt is in progress
+	if (_connectionState.load(std::memory_order_acquire) != ConnectionState::Disconnected)
+	{
+		return;
+	}
+
+	// Wait until the reconnect delay has passed. If a reconnect cannot succeed at all, the next attempt was scheduled
+	// for the end of time.
+	if (context.scheduledTime() < _nextReconnectTime)
+	{
+		return;
+	}
+
+	// Attempt a connection
+	startConnect(context.scheduledTime());
+
+	// Pass the result of the attempt on right away if it was made synchronously, so that the data points do not keep
+	// their old state until the next execution
+	if (deliverStateChanges)
+	{
+		deliverStateChange();
+	}
+}
+
+auto TemplateIoComponent::performRead(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Only perform the read if the I/O component is connected
+	if (!connected())
+	{
+		return;
+	}
+
+	// Read the data
+	batchRead(timeStamp);
+}
+
+auto TemplateIoComponent::batchRead(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	Tracer::Span span { tracer(), "batchRead"sv };
+
+	const auto blocks = _readPlan.blocks();
+	std::size_t nextBlock = 0;
+
+	// Limit the time spent waiting for responses, and the number of responses that belong to no outstanding request. Any more
+	// unmatched responses than the window size mean the device is not answering our requests.
+	const auto deadline = std::chrono::steady_clock::now() + _batchReadTimeout;
+	std::size_t unmatchedResponses = 0;
+
+	// Keep the transaction window filled until all blocks have been read
+	while (nextBlock < blocks.size() || _readTransactions.outstanding() > 0)
+	{
+		// Send requests until the window is full
+		while (nextBlock < blocks.size() && !_readTransactions.full() && connected())
+		{
+			sendBlockRequest(timeStamp, nextBlock++);
+		}
+
+		// Stop if the connection was lost
+		if (!connected())
+		{
+			break;
+		}
+
+		// Wait for the next response, if there is anything to wait for
+		if (_readTransactions.outstanding() > 0 && !receiveBlockResponse(timeStamp))
+		{
+			++unmatchedResponses;
+		}
+
+		// Stop if the connection was lost while receiving
+		if (!connected())
+		{
+			break;
+		}
+
+		// Give up on the rest of the blocks if the device takes too long, or keeps sending responses we cannot match.
+		// The responses to the requests we give up on may still arrive later, and protocols without transaction IDs
+		// would pair them with the requests of the next execution. We therefore drop the connection, which also
+		// notifies all the data points of the error.
+		if ((nextBlock < blocks.size() || _readTransactions.outstanding() > 0) &&
+			(unmatchedResponses > _maxOutstandingRequests || std::chrono::steady_clock::now() >= deadline))
+		{
+			handleError(timeStamp, CustomError::ResponseTimeout);
+			break;
+		}
+	}
+
+	// Forget about any requests whose responses we will never receive. All the data points have been notified of
+	// the lost connection already.
+	_readTransactions.abort([](const ReadTransaction &) {});
+}
+
+auto TemplateIoComponent::sendBlockRequest(std::chrono::system_clock::time_point timeStamp, std::size_t blockIndex) -> void
+{
+	const auto &block = _readPlan.blocks()[blockIndex];
+
+	// Open a transaction. This cannot fail, because the caller has checked that the window is not full.
+	const auto transactionId = _readTransactions.open({ blockIndex, std::chrono::steady_clock::now() });
+
+	try
+	{
+		// Send the request without waiting for the response
+		_handle.sendBlockRequest(*transactionId, { block._address, block._size });
+	}
+	catch (const std::exception &)
+	{
+		// The request was never sent, so close the transaction
+		_readTransactions.close(*transactionId);
+
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleBatchReadError(timeStamp, error, blockSinks(block));
+	}
+}
+
+auto TemplateIoComponent::receiveBlockResponse(std::chrono::system_clock::time_point timeStamp) -> bool
+{
+	try
+	{
+		// Receive the next response into the buffer. If the protocol has no transaction IDs, the responses arrive in order,
+		// so the response belongs to the oldest outstanding request.
+		const auto responseId = _handle.receiveBlockResponse(_readBuffer);
+		const auto transactionId =
+			responseId ? TransactionWindow<ReadTransaction>::TransactionId(*responseId) : _readTransactions.oldest();
+
+		// Find the request that belongs to the response, and ignore responses that don't belong to an outstanding
+		// request. This can happen if a response arrives after the request was given up on.
+		const auto transaction = _readTransactions.close(transactionId);
+		if (!transaction)
+		{
+			return false;
+		}
+		const auto &block = _readPlan.blocks()[transaction->_blockIndex];
+		recordBlockRead(block, std::chrono::steady_clock::now() - transaction->_sendTime);
+
+		/// @todo if the response contains an error for the entire block, pass it to handleBatchReadError() and return.
+
+		// Pass the results on to the individual data points. An error decoding the value of one data point only affects that data point.
+		for (auto &&sink : blockSinks(block))
+		{
+			const auto valueOrError = [&]() -> utils::eh::expected<double, std::error_code> {
+				try
+				{
+					return _handle.decodeValue(_readBuffer, { block._address, block._size }, sink.get().addressRange());
+				}
+				catch (const std::exception &)
+				{
+					return utils::eh::unexpected(utils::eh::currentErrorCode());
+				}
+			}();
+
+			sink.get().batchReadCompleted(timeStamp, valueOrError);
+		}
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+
+		// We cannot tell which request the error belongs to, so all outstanding requests have failed
+		_readTransactions.abort([&](const ReadTransaction &transaction) {
+			handleBatchReadError(timeStamp, error, blockSinks(_readPlan.blocks()[transaction._blockIndex]));
+		});
+	}
+
+	return true;
+}
+
+auto TemplateIoComponent::recordBlockRead(const RequestPlan::Block &block, std::chrono::nanoseconds roundTrip) noexcept -> void
+{
+	_statistics.recordRead(roundTrip);
+
+	// Find out how much of the block actually belongs to a data point
+	std::size_t usedUnits = 0;
+	for (auto &&sink : blockSinks(block))
+	{
+		usedUnits += sink.get().addressRange()._size;
+	}
+	_statistics.recordBlock(usedUnits, block._size);
+}
+
+auto TemplateIoComponent::handleBatchReadError(std::chrono::system_clock::time_point timeStamp,
+	std::error_code error,
+	std::span<const std::reference_wrapper<ReadSink>> sinks) -> void
+{
+	// If the error affects the I/O component as a whole, all the data points will be notified via their error sink interface,
+	// so we need not update them individually.
+	if (isConnectionError(error))
+	{
+		handleError(timeStamp, error);
+		return;
+	}
+
+	// Count the error, which handleError() would otherwise have done
+	countError(error);
+
+	// Pass the error on to all the data points that were part of the block
+	for (auto &&sink : sinks)
+	{
+		sink.get().batchReadCompleted(timeStamp, utils::eh::unexpected(error));
+	}
+}
+
+auto TemplateIoComponent::performWrite(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Only perform the write if the I/O component is connected
+	if (!connected())
+	{
+		return;
+	}
+
+	// Write the data
+	batchWrite(timeStamp);
+}
+
+auto TemplateIoComponent::batchWrite(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	Tracer::Span span { tracer(), "batchWrite"sv };
+
+	// Don't ask for a token if no data point has a value to write, so that idle cycles are not counted as throttled
+	if (std::ranges::none_of(_dirtyWrites, [](const auto &word) { return word.load(std::memory_order_relaxed) != 0; }))
+	{
+		return;
+	}
+
+	// Wait for the write rate limit. If we have to wait, the dirty bits stay set, and newer values replace the pending ones.
+	// This token is for the first request. Any further requests take their own tokens below.
+	if (!tryAcquireWriteToken())
+	{
+		return;
+	}
+
+	// Collect the values of all the dirty write sinks. Because the sinks are sorted by address, this yields them in address order,
+	// with the members of each write group next to each other.
+	_writeBatch.clear();
+	_writeRanges.clear();
+	_writeValues.clear();
+	_groupWriteBatch.clear();
+	_groupWriteRanges.clear();
+	_groupWriteValues.clear();
+	for (std::size_t word = 0; word < _dirtyWrites.size(); ++word)
+	{
+		// Take the dirty bits of a whole word at once. Idle words cost only a single exchange.
+		auto bits = _dirtyWrites[word].exchange(0, std::memory_order_acq_rel);
+		while (bits != 0)
+		{
+			const auto index = word * kDirtyWordBits + std::size_t(std::countr_zero(bits));
+			bits &= bits - 1;
+
+			// Get the value. There might be none if the data point's own "write" task got to it first.
+			auto &sink = _writeSinks[index].get();
+			const auto value = sink.dequeueBatchWriteValue(timeStamp);
+			if (!value)
+			{
+				continue;
+			}
+
+			// Data points that belong to a write group are written separately
+			if (sink.writeGroup() != 0)
+			{
+				_groupWriteBatch.push_back(sink);
+				_groupWriteRanges.push_back(sink.addressRange());
+				_groupWriteValues.push_back(*value);
+				continue;
+			}
+
+			_writeBatch.push_back(sink);
+			_writeRanges.push_back(sink.addressRange());
+			_writeValues.push_back(*value);
+		}
+	}
+
+	// Give back the token if the data points' own "write" tasks took all the values in the meantime
+	if (_writeBatch.empty() && _groupWriteBatch.empty())
+	{
+		refundWriteToken();
+		return;
+	}
+
+	// Merge neighbouring data points into blocks. Gaps cannot be bridged, because that would overwrite the addresses in between.
+	_writePlan.compute(_writeRanges, 0, _maxRequestSize);
+
+	// Each block and each write group is a separate request that needs its own token. The first request uses the token taken
+	// above. Once the rate limit is reached, the remaining values are handed back to their data points, and sent next time.
+	bool haveToken = true;
+	bool throttled = false;
+	const auto tryAcquireRequestToken = [&]() {
+		if (!throttled && !std::exchange(haveToken, false))
+		{
+			throttled = !tryAcquireWriteToken();
+		}
+		return !throttled;
+	};
+
+	// Write the blocks
+	for (auto &&block : _writePlan.blocks())
+	{
+		// If the connection was lost, the remaining values cannot be written anymore
+		if (!connected())
+		{
+			for (auto &&sink : blockWriteSinks(block))
+			{
+				sink.get().batchWriteCompleted(timeStamp, CustomError::NotConnected);
+			}
+			continue;
+		}
+
+		if (!tryAcquireRequestToken())
+		{
+			deferBatchWrite(blockWriteSinks(block));
+			continue;
+		}
+
+		writeBlock(timeStamp, block);
+	}
+
+	// Write the groups
+	for (std::size_t begin = 0; begin < _groupWriteBatch.size();)
+	{
+		// Find the end of the group
+		const auto group = _groupWriteBatch[begin].get().writeGroup();
+		auto end = begin + 1;
+		while (end < _groupWriteBatch.size() && _groupWriteBatch[end].get().writeGroup() == group)
+		{
+			++end;
+		}
+
+		// Write the group. Values that cannot be sent because of the rate limit are sent next time, unless the connection was
+		// lost, which writeGroupTransaction() reports.
+		if (!connected() || tryAcquireRequestToken())
+		{
+			writeGroupTransaction(timeStamp, begin, end);
+		}
+		else
+		{
+			deferBatchWrite(std::span(_groupWriteBatch).subspan(begin, end - begin));
+		}
+
+		begin = end;
+	}
+
+	// Give back the token if no request was sent after all, because the connection was lost
+	if (haveToken)
+	{
+		refundWriteToken();
+	}
+}
+
+auto TemplateIoComponent::deferBatchWrite(std::span<const std::reference_wrapper<WriteSink>> sinks) noexcept -> void
+{
+	for (auto &&sink : sinks)
+	{
+		sink.get().restoreBatchWriteValue();
+		markWriteDirty(sink);
+	}
+}
+
+auto TemplateIoComponent::writeGroupTransaction(std::chrono::system_clock::time_point timeStamp, std::size_t begin, std::size_t end)
+	-> void
+{
+	// Write the group, unless the connection was lost
+	std::error_code error = CustomError::NotConnected;
+	if (connected())
+	{
+		try
+		{
+			const auto requestTime = std::chrono::steady_clock::now();
+
+			// Write the values using a single transaction, so that the device applies either all of them or none
+			_handle.writeTransaction(std::span(_groupWriteRanges).subspan(begin, end - begin),
+				std::span(_groupWriteValues).subspan(begin, end - begin));
+
+			// The write was successful
+			const auto roundTrip = std::chrono::steady_clock::now() - requestTime;
+			_writeLatency.recordDevice(roundTrip);
+			_statistics.recordWrite(roundTrip);
+			error = {};
+		}
+		catch (const std::exception &)
+		{
+			// Get the error from the current exception using this special utility function
+			error = utils::eh::currentErrorCode();
+		}
+	}
+
+	// Update all the data points, and collect their events. Each data point raises one event for its write state, and
+	// possibly one for its read state if it uses write-through.
+	_groupWriteEvents.clear();
+	for (auto index = begin; index < end; ++index)
+	{
+		_groupWriteBatch[index].get().batchWriteCompleted(timeStamp, error, _groupWriteEvents);
+	}
+
+	// Raise the events of all the data points together. The lock must be released again before calling handleError() below.
+	{
+		std::scoped_lock lock { _stateMutex };
+		publishState(timeStamp, _groupWriteEvents);
+	}
+
+	// Notify the I/O component, if the error affects it as a whole. There is no need to do this if we were not connected
+	// in the first place. Other errors are just counted.
+	if (isConnectionError(error) && error != CustomError::NotConnected)
+	{
+		handleError(timeStamp, error);
+	}
+	else if (error && error != CustomError::NotConnected)
+	{
+		countError(error);
+	}
+}
+
+auto TemplateIoComponent::writeBlock(std::chrono::system_clock::time_point timeStamp, const RequestPlan::Block &block) -> void
+{
+	try
+	{
+		const auto requestTime = std::chrono::steady_clock::now();
+
+		// Write the values using a single write request
+		_handle.writeBlock(std::span(_writeRanges).subspan(block._begin, block._end - block._begin),
+			std::span(_writeValues).subspan(block._begin, block._end - block._begin));
+
+		// The write was successful
+		const auto roundTrip = std::chrono::steady_clock::now() - requestTime;
+		_writeLatency.recordDevice(roundTrip);
+		_statistics.recordWrite(roundTrip);
+		for (auto &&sink : blockWriteSinks(block))
+		{
+			sink.get().batchWriteCompleted(timeStamp, std::error_code());
+		}
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleBatchWriteError(timeStamp, error, blockWriteSinks(block));
+	}
+}
+
+auto TemplateIoComponent::handleBatchWriteError(std::chrono::system_clock::time_point timeStamp,
+	std::error_code error,
+	std::span<const std::reference_wrapper<WriteSink>> sinks) -> void
+{
+	// Pass the error on to all the data points that were part of the block. The write state of the data points is not
+	// affected by the state of the I/O component, so we must do this even for connection errors.
+	for (auto &&sink : sinks)
+	{
+		sink.get().batchWriteCompleted(timeStamp, error);
+	}
+
+	// Notify the I/O component, if the error affects it as a whole. Otherwise, just count the error.
+	if (isConnectionError(error))
+	{
+		handleError(timeStamp, error);
+	}
+	else
+	{
+		countError(error);
+	}
+}
+
+auto TemplateIoComponent::startConnect(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Don't queue for a connection attempt if we are not disconnected
+	if (_connectionState.load(std::memory_order_acquire) != ConnectionState::Disconnected)
+	{
+		return;
+	}
+
+	// Ask the governor for permission. If we don't get it, we stay queued, and the "reconnect" task will try again.
+	const auto grant = _reconnectGovernor.get().tryAcquire(_reconnectWaiter);
+	if (!grant)
+	{
+		return;
+	}
+	// The grant is published together with the rest of the state, so it must be changed under the lock
+	{
+		std::scoped_lock lock { _stateMutex };
+		_reconnectGrant = *grant;
+	}
+
+	// Only start a connection attempt if we are still disconnected. This also prevents two attempts from running at once.
+	auto expectedState = ConnectionState::Disconnected;
+	if (!_connectionState.compare_exchange_strong(expectedState, ConnectionState::Connecting, std::memory_order_acq_rel))
+	{
+		_reconnectGovernor.get().release();
+		return;
+	}
+
+	// Make sure the threads we need are running. If they cannot be started, the attempt fails, and the "reconnect" task
+	// will try again later.
+	if (const auto error = startThreads())
+	{
+		finishConnect(timeStamp, error);
+		return;
+	}
+
+	// Connect directly if asynchronous connection is not enabled
+	if (!_asynchronousConnect)
+	{
+		finishConnect(timeStamp, connect());
+		return;
+	}
+
+	// Hand the attempt to the connect thread
+	{
+		std::scoped_lock lock { _connectMutex };
+		_connectRequested = true;
+	}
+	_connectCondition.notify_one();
+}
+
+auto TemplateIoComponent::startThreads() noexcept -> std::error_code
+{
+	try
+	{
+		// Start the I/O thread first, so that it is ready as soon as we are connected
+		if (_ioWorker)
+		{
+			_ioWorker->start();
+		}
+		// Start the connect thread, so that it is ready to take the connection attempt
+		if (_asynchronousConnect && !_connectThread.joinable())
+		{
+			_connectThread = std::jthread([this](std::stop_token stopToken) { runConnectThread(stopToken); });
+		}
+
+		return std::error_code();
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		return utils::eh::currentErrorCode();
+	}
+}
+
+auto TemplateIoComponent::runConnectThread(std::stop_token stopToken) -> void
+{
+	std::unique_lock lock { _connectMutex };
+	while (_connectCondition.wait(lock, stopToken, [&]() { return _connectRequested; }) && !stopToken.stop_requested())
+	{
+		_connectRequested = false;
+
+		// Make the attempt without holding the lock, so that the next attempt can be requested as soon as this one has
+		// published its result. The time stamp is taken when the attempt completes.
+		lock.unlock();
+		const auto error = connect();
+		finishConnect(std::chrono::system_clock::now(), error);
+		lock.lock();
+	}
+}
+
+auto TemplateIoComponent::stopConnectThread() -> void
 {
-	// Only perform the reconnect if we are supposed to be connected in the first place
-	if (_connectionRequestCount.load(std::memory_order_relaxed) == 0)
-	{
-		return;
-	}
-	// Also don't reconnect if we are already connected
-	if (_handle)
+	// Nothing to do if the thread is not running
+	if (!_connectThread.joinable())
 	{
 		return;
 	}
 
-	/// @todo check _lastError to see if a reconnect can succeed at all, and bail if it can't. A reconnect need not be attempted
-	// if it requires non-existent hardware, like a missing network adapter or I/O card, for example.
-	// see isConnectionError() for an example on how to check error codes.
+	// Tell the thread to stop, which also wakes it up, and wait for any attempt in progress to complete
+	_connectThread.request_stop();
+	_connectThread.join();
 
-	// Attempt a connection
-	connect(context.scheduledTime());
+	// An attempt that was requested but never started still holds the permission of the reconnect governor
+	std::scoped_lock lock { _connectMutex };
+	if (std::exchange(_connectRequested, false))
+	{
+		_reconnectGovernor.get().release();
+	}
 }
 
-auto TemplateIoComponent::connect(std::chrono::system_clock::time_point timeStamp) -> void
+auto TemplateIoComponent::connect() -> std::error_code
 {
+	Tracer::Span span { tracer(), "connect"sv };
+
 	try
 	{
-		/// @todo try to establish the connection, and set the _handle object
-
-		/// @todo if the connect function does not throw errors, but uses return types or internal handle state,
-		// throw an std::system_error here on failure, or call updateState() directly.
-		
-		// Note: If your connect function uses normal system error codes (errno on Linux or GetLastError() on Windows), you
-		// should create std::error_codes using std::system_category(). If you are using a library and/or protocol that provides
-		// its own error codes, you should define a custom error category.
+		// Try to establish the connection. While we are connecting, the handle belongs to us, so we need not lock the mutex.
+		_handle = Handle::open();
 
 		// The connection was successful
-		updateState(timeStamp, std::error_code());
+		return std::error_code();
 	}
 	/// @todo if your connection function throws exceptions that are not derived from std::system_error, but that
 	// still provide some sort of error code, you should catch those exceptions separately and wrap the error code in a custom
@@ -110,23 +818,117 @@ auto TemplateIoComponent::connect(std::chrono::system_clock::time_point timeStam
 	catch (const std::exception &)
 	{
 		// Get the error from the current exception using this special utility function
-		const auto error = utils::eh::currentErrorCode();
-		
-		// Update the state
+		return utils::eh::currentErrorCode();
+	}
+}
+
+auto TemplateIoComponent::finishConnect(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
+{
+	// Let other I/O components connect
+	_reconnectGovernor.get().release();
+
+	// Count failed attempts
+	if (error)
+	{
+		countError(error);
+	}
+
+	// The reconnect schedule is published together with the rest of the state, so it must be changed under the lock
+	std::scoped_lock lock { _stateMutex };
+
+	// Schedule the next attempt. This must be done before the connection state is published, because the "reconnect" task
+	// may run as soon as we are disconnected.
+	scheduleReconnect(timeStamp, error);
+
+	// Publish the new connection state before notifying the error sinks, so that they see the correct state
+	_connectionState.store(error ? ConnectionState::Disconnected : ConnectionState::Connected, std::memory_order_release);
+
+	// Update the state. If the error has not changed, only the reconnect schedule needs to be published.
+	if (error == _lastError)
+	{
+		publishState(timeStamp);
+	}
+	else
+	{
 		updateState(timeStamp, error);
 	}
 }
 
+auto TemplateIoComponent::scheduleReconnect(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
+{
+	// On success, reset the schedule, so that the first reconnect after the connection is lost is attempted immediately
+	if (!error)
+	{
+		_reconnectAttempts = 0;
+		_nextReconnectTime = std::chrono::system_clock::time_point::min();
+		return;
+	}
+
+	++_reconnectAttempts;
+
+	// If a reconnect cannot succeed until something changes, e.g. a missing network adapter is plugged in, only try again
+	// after the maximum delay. The error stays visible in the device error attribute until a connection succeeds.
+	if (isPermanentError(error))
+	{
+		_nextReconnectTime = timeStamp + _maxReconnectDelay;
+		return;
+	}
+
+	_nextReconnectTime = timeStamp + reconnectDelay(_reconnectAttempts);
+}
+
+auto TemplateIoComponent::reconnectDelay(std::uint64_t attempts) -> std::chrono::system_clock::duration
+{
+	// Reconnect right away if backoff is disabled
+	if (_reconnectDelay == 0s)
+	{
+		return std::chrono::system_clock::duration::zero();
+	}
+
+	// Double the delay after each failed attempt. The exponent is capped, because the maximum delay will have been
+	// reached long before that anyway.
+	const auto exponent = std::min<std::uint64_t>(attempts - 1, 32);
+	const auto backoff =
+		std::min(std::chrono::duration<double, std::milli>(_reconnectDelay) * std::exp2(double(exponent)),
+			std::chrono::duration<double, std::milli>(_maxReconnectDelay));
+
+	// Shorten the delay by a random fraction of up to the jitter
+	std::uniform_real_distribution<double> jitter { 1.0 - _reconnectJitter, 1.0 };
+	return std::chrono::duration_cast<std::chrono::system_clock::duration>(backoff * jitter(_jitterEngine));
+}
+
 auto TemplateIoComponent::disconnect(std::chrono::system_clock::time_point timeStamp) -> void
 {
-	// Reset the handle in any case, even if we fail, because the connection state should be false after this
-	auto handle = std::exchange(_handle, Handle());
+	Tracer::Span span { tracer(), "disconnect"sv };
+
+	// Wait for any asynchronous connection attempt to complete, so that it doesn't set the handle behind our back
+	stopConnectThread();
 
-	/// @todo close the connection, ignoring any errors. If the disconnect function can throw exceptions,
-	// these shoudl be caucht and ignored.
+	// Leave the queue of the reconnect governor, in case we were still waiting
+	_reconnectGovernor.get().withdraw(_reconnectWaiter);
 
-	// This is always a graceful disconnect, regardless of what happened, so never include an error code.
-	updateState(timeStamp, CustomError::NotConnected);
+	{
+		// Keep handleError() from changing the handle or the error while we disconnect
+		std::scoped_lock lock { _stateMutex };
+
+		// Reset the reconnect schedule, so that a new connection request is not delayed
+		_reconnectAttempts = 0;
+		_nextReconnectTime = std::chrono::system_clock::time_point::min();
+
+		// Reset the handle in any case, even if we fail, because the connection state should be false after this
+		_connectionState.store(ConnectionState::Disconnected, std::memory_order_release);
+		_handle.close();
+
+		// This is always a graceful disconnect, regardless of what happened, so never include an error code.
+		updateState(timeStamp, CustomError::NotConnected);
+	}
+
+	// The I/O thread has been stopped, and the "reconnect" task will not run again, so batched state changes must be
+	// delivered here
+	if (_batchStateChanges)
+	{
+		deliverStateChange();
+	}
 }
 
 auto TemplateIoComponent::updateState(std::chrono::system_clock::time_point timeStamp, std::error_code error, const ErrorSink *excludeErrorSink)
@@ -141,7 +943,10 @@ auto TemplateIoComponent::updateState(std::chrono::system_clock::time_point time
 	// Get the old and new state
 	const auto wasConnected = !_lastError;
 	const auto connected = !error;
-	
+
+	// Remember the new error, so that later calls can tell whether anything changed
+	_lastError = error;
+
 	// Make a write sentinel
 	memory::WriteSentinel sentinel { _stateDataBlock };
 	auto &state = *sentinel;
@@ -157,6 +962,15 @@ auto TemplateIoComponent::updateState(std::chrono::system_clock::time_point time
 	// Update the error code
 	state._error = error;
 
+	// Update the reconnect schedule
+	state._reconnectAttempts = _reconnectAttempts;
+	state._nextReconnectTime = _nextReconnectTime;
+	state._reconnectQueueDepth = _reconnectGrant._queueDepth;
+	state._reconnectWaitTime = _reconnectGrant._waitTime;
+
+	// Update the counters
+	state._throttledWrites = _throttledWrites.load(std::memory_order_relaxed);
+
 	// Collect the events to raise
 	process::StaticEventList<1> events;
 	if (!wasConnected && connected)
@@ -171,6 +985,20 @@ auto TemplateIoComponent::updateState(std::chrono::system_clock::time_point time
 	// Commit the data and raise the events
 	sentinel.commit(timeStamp, events);
 
+	// If state changes are batched, leave notifying the error sinks to deliverStateChange(), so that the caller does not have to
+	// wait for it with the lock held. Only the latest change is delivered, so a change that was not delivered yet is superseded.
+	if (_batchStateChanges)
+	{
+		_pendingStateChange = StateChange { timeStamp, error, excludeErrorSink };
+
+		// Hand the delivery to the I/O thread, if we have one. Otherwise, the "reconnect" task delivers it.
+		if (_ioWorker)
+		{
+			_ioWorker->post(_stateChangeJob, timeStamp);
+		}
+		return;
+	}
+
 	// Notify all error sinks
 	for (auto &&sink : _errorSinks)
 	{
@@ -181,6 +1009,86 @@ auto TemplateIoComponent::updateState(std::chrono::system_clock::time_point time
 	}
 }
 
+auto TemplateIoComponent::deliverStateChange() -> void
+{
+	// Only one thread may update the error sinks at a time, so that the changes reach them in order
+	std::scoped_lock stateChangeLock { _stateChangeMutex };
+
+	// Take the latest change, if there is one
+	std::optional<StateChange> change;
+	{
+		std::scoped_lock lock { _stateMutex };
+		change = std::exchange(_pendingStateChange, std::nullopt);
+	}
+	if (!change)
+	{
+		return;
+	}
+
+	// Update all the error sinks, collecting their events. This is done without holding _stateMutex, so that data points
+	// reporting errors in the meantime are not held up.
+	_stateEvents.clear();
+	for (auto &&sink : _errorSinks)
+	{
+		if (&sink.get() != change->_excludeErrorSink)
+		{
+			sink.get().ioComponentStateChanged(change->_timeStamp, change->_error, _stateEvents);
+		}
+	}
+
+	// Raise the events of all the error sinks together
+	if (!_stateEvents.empty())
+	{
+		std::scoped_lock lock { _stateMutex };
+		publishState(change->_timeStamp, _stateEvents);
+	}
+}
+
+auto TemplateIoComponent::publishState(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// There are no events to raise
+	publishState(timeStamp, process::DynamicEventList());
+}
+
+auto TemplateIoComponent::publishState(std::chrono::system_clock::time_point timeStamp, const process::DynamicEventList &events) -> void
+{
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _stateDataBlock };
+	auto &state = *sentinel;
+
+	// Keep the rest of the state. We need to copy it, because memory resources use swap-in.
+	state = sentinel.oldValue();
+
+	// Update the reconnect schedule
+	state._reconnectAttempts = _reconnectAttempts;
+	state._nextReconnectTime = _nextReconnectTime;
+	state._reconnectQueueDepth = _reconnectGrant._queueDepth;
+	state._reconnectWaitTime = _reconnectGrant._waitTime;
+
+	// Update the counters
+	state._throttledWrites = _throttledWrites.load(std::memory_order_relaxed);
+
+	// Commit the data and raise the events
+	sentinel.commit(timeStamp, events);
+}
+
+auto TemplateIoComponent::countError(std::error_code error) noexcept -> void
+{
+	/// @todo check for any other errors your protocol uses to signal timeouts
+	if (error == std::errc::timed_out || error == CustomError::ResponseTimeout)
+	{
+		_statistics.recordError(IoStatistics::ErrorCategory::Timeout);
+	}
+	else if (isConnectionError(error))
+	{
+		_statistics.recordError(IoStatistics::ErrorCategory::Connection);
+	}
+	else
+	{
+		_statistics.recordError(IoStatistics::ErrorCategory::Request);
+	}
+}
+
 auto TemplateIoComponent::isConnectionError(std::error_code error) noexcept -> bool
 {
 	/// @todo check if this error affects the connection as a whole, and bail if it doesn't.
@@ -233,6 +1141,7 @@ auto TemplateIoComponent::isConnectionError(std::error_code error) noexcept -> b
 		switch (CustomError(error.value()))
 		{
 		case CustomError::NotConnected:
+		case CustomError::ResponseTimeout:
 		case CustomError::UnknownError:
 			/// @todo add case statements for other relevant custom errors (like e.g. timeout) here
 			return true;
@@ -251,15 +1160,53 @@ auto TemplateIoComponent::isConnectionError(std::error_code error) noexcept -> b
 	}
 }
 
+auto TemplateIoComponent::isPermanentError(std::error_code error) noexcept -> bool
+{
+	/// @todo check if this error means that the connection can never be established, so that a reconnect need not be
+	// attempted. This is the case if the connection requires non-existent hardware, like a missing network adapter
+	// or I/O card, for example.
+
+	// Example code suitable for socket errors:
+
+	// Check system errors
+	if (error.category() == std::system_category())
+	{
+		switch (error.value())
+		{
+	#ifdef _WIN32
+		case WSAEADDRNOTAVAIL:
+		case WSAEAFNOSUPPORT:
+		case WSAEPROTONOSUPPORT:
+		case ERROR_DEV_NOT_EXIST:
+	#else // _WIN32
+		case EADDRNOTAVAIL:
+		case EAFNOSUPPORT:
+		case EPROTONOSUPPORT:
+		case ENODEV:
+		case ENXIO:
+	#endif // _WIN32
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	/// @todo check custom errors, if any of them are permanent
+
+	// No other categories need apply
+	return false;
+}
+
 auto TemplateIoComponent::requestConnect(std::chrono::system_clock::time_point timeStamp) noexcept -> void
 {
 	// increment the count
 	const auto oldCount = _connectionRequestCount++;
 
-	// connect if the old count was 0
+	// connect if the old count was 0. This also starts the I/O thread and the connect thread, if they are used.
 	if (oldCount == 0)
 	{
-		connect(timeStamp);
+		startConnect(timeStamp);
 	}
 }
 
@@ -271,26 +1218,38 @@ auto TemplateIoComponent::requestDisconnect(std::chrono::system_clock::time_poin
 	// disconnect if the new count is 0
 	if (newCount == 0)
 	{
+		// Stop the I/O thread first, so that no I/O is in progress when we disconnect
+		if (_ioWorker)
+		{
+			_ioWorker->stop();
+		}
+
 		disconnect(timeStamp);
 	}
 }
 
 auto TemplateIoComponent::handleError(std::chrono::system_clock::time_point timeStamp, std::error_code error, const ErrorSink *sender) noexcept -> void
 {
+	// Data points on different threads may report errors at the same time, so only one of them may look at and change the state
+	std::scoped_lock lock { _stateMutex };
+
 	// Ignore any new errors if we already have an error (the first error always wins).
 	if (_lastError)
 	{
 		return;
 	}
+	// Count the error. We do this after the check above, so that the errors caused by the same broken connection are only counted once.
+	countError(error);
 	// Check if this error affects the connection as a whole, and bail if it doesn't. This function shoudl
 	if (!isConnectionError(error))
 	{
 		return;
 	}
 
-	// Reset the handle
-	/// @todo gracefully close the handle, if this is necessary
-	_handle = Handle();
+	// Close the handle
+	_handle.close();
+	// Mark the connection as lost, so that the "reconnect" task will attempt to reconnect
+	_connectionState.store(ConnectionState::Disconnected, std::memory_order_release);
 
 	// update the error state
 	updateState(timeStamp, error, sender);
@@ -319,7 +1278,20 @@ auto TemplateIoComponent::forEachAttribute(const model::ForEachAttributeFunction
 	return
 		function(model::Attribute::kDeviceState) ||
 		function(attributes::kConnectionTime) ||
-		function(attributes::kDeviceError);
+		function(attributes::kDeviceError) ||
+		function(attributes::kReconnectAttempts) ||
+		function(attributes::kNextReconnectTime) ||
+		function(attributes::kReconnectQueueDepth) ||
+		function(attributes::kReconnectWaitTime) ||
+		function(attributes::kThrottledWrites) ||
+		_writeLatency.forEachAttribute(function) ||
+		_statistics.forEachAttribute(function) ||
+		// Handle the task monitor attributes. The "flushTrace" task is only available if tracing is enabled.
+		_reconnectTask.monitor().forEachAttribute(function) ||
+		_batchReadTask.monitor().forEachAttribute(function) ||
+		_batchWriteTask.monitor().forEachAttribute(function) ||
+		_publishStatisticsTask.monitor().forEachAttribute(function) ||
+		(_tracer && _flushTraceTask.monitor().forEachAttribute(function));
 }
 
 auto TemplateIoComponent::forEachEvent(const model::ForEachEventFunction &function) -> bool
@@ -327,7 +1299,13 @@ auto TemplateIoComponent::forEachEvent(const model::ForEachEventFunction &functi
 	// Handle all the events we support
 	return
 		function(process::Event::kConnected, sharedFromThis(&_connectedEvent)) ||
-		function(process::Event::kDisconnected, sharedFromThis(&_disconnectedEvent));
+		function(process::Event::kDisconnected, sharedFromThis(&_disconnectedEvent)) ||
+		// Handle the task monitor events
+		_reconnectTask.monitor().forEachEvent(function, sharedFromThis()) ||
+		_batchReadTask.monitor().forEachEvent(function, sharedFromThis()) ||
+		_batchWriteTask.monitor().forEachEvent(function, sharedFromThis()) ||
+		_publishStatisticsTask.monitor().forEachEvent(function, sharedFromThis()) ||
+		(_tracer && _flushTraceTask.monitor().forEachEvent(function, sharedFromThis()));
 
 	/// @todo handle any additional events this class supports
 }
@@ -336,7 +1314,12 @@ auto TemplateIoComponent::forEachTask(const model::ForEachTaskFunction &function
 {
 	// Handle all the tasks we support
 	return
-		function(process::Task::kReconnect, sharedFromThis(&_reconnectTask));
+		function(process::Task::kReconnect, sharedFromThis(&_reconnectTask)) ||
+		function(tasks::kBatchRead, sharedFromThis(&_batchReadTask)) ||
+		function(tasks::kBatchWrite, sharedFromThis(&_batchWriteTask)) ||
+		function(tasks::kPublishStatistics, sharedFromThis(&_publishStatisticsTask)) ||
+		// The "flushTrace" task is only available if tracing is enabled
+		(_tracer && function(tasks::kFlushTrace, sharedFromThis(&_flushTraceTask)));
 
 	/// @todo handle any additional tasks this class supports
 }
@@ -356,6 +1339,57 @@ auto TemplateIoComponent::makeReadHandle(const model::Attribute &attribute) cons
 	{
 		return _stateDataBlock.member(&State::_error);
 	}
+	else if (attribute == attributes::kReconnectAttempts)
+	{
+		return _stateDataBlock.member(&State::_reconnectAttempts);
+	}
+	else if (attribute == attributes::kNextReconnectTime)
+	{
+		return _stateDataBlock.member(&State::_nextReconnectTime);
+	}
+	else if (attribute == attributes::kReconnectQueueDepth)
+	{
+		return _stateDataBlock.member(&State::_reconnectQueueDepth);
+	}
+	else if (attribute == attributes::kReconnectWaitTime)
+	{
+		return _stateDataBlock.member(&State::_reconnectWaitTime);
+	}
+	else if (attribute == attributes::kThrottledWrites)
+	{
+		return _stateDataBlock.member(&State::_throttledWrites);
+	}
+	// Try the write latency attributes
+	else if (auto handle = _writeLatency.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	// Try the statistics attributes
+	else if (auto handle = _statistics.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	// Try the task monitor attributes
+	else if (auto handle = _reconnectTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	else if (auto handle = _batchReadTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	else if (auto handle = _batchWriteTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	else if (auto handle = _publishStatisticsTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	else if (auto handle = _tracer ? _flushTraceTask.monitor().makeReadHandle(attribute) : std::nullopt)
+	{
+		return handle;
+	}
 
 	/// @todo handle any additional readable attributes this class supports
 
@@ -365,8 +1399,107 @@ auto TemplateIoComponent::makeReadHandle(const model::Attribute &attribute) cons
 
 auto TemplateIoComponent::realize() -> void
 {
-	// Create the data block
+	// Create the data blocks
 	_stateDataBlock.create(memory::memoryResources::data());
+	_writeLatency.realize();
+
+	// Set up the statistics
+	_statistics.setWindow(_statisticsWindow);
+	_statistics.realize();
+
+	// Set up the task monitors
+	_reconnectTask.monitor().realize();
+	_batchReadTask.monitor().realize();
+	_batchWriteTask.monitor().realize();
+	_publishStatisticsTask.monitor().realize();
+	_flushTraceTask.monitor().realize();
+
+	// Set up the write rate limiter
+	_writeLimiter.configure(_writeRate, _writeBurst);
+
+	// Sort the read sinks by address, so that neighbouring data points can be read together
+	std::ranges::stable_sort(_readSinks, {}, [](const ReadSink &sink) { return sink.addressRange()._address; });
+
+	// Compute the request plan for the "batchRead" task
+	std::vector<AddressRange> ranges;
+	ranges.reserve(_readSinks.size());
+	for (auto &&sink : _readSinks)
+	{
+		ranges.push_back(sink.get().addressRange());
+	}
+	_readPlan.compute(ranges, _maxRequestGap, _maxRequestSize);
+
+	// Allocate the response buffer up front, so that the "batchRead" task need not allocate any memory
+	/// @todo adjust the buffer size to the size of the response for the largest block
+	_readBuffer.resize(_readPlan.largestBlockSize());
+
+	// Size the transaction window
+	_readTransactions.resize(_maxOutstandingRequests);
+
+	// Allocate the event list for batched state changes up front, so that state changes need not allocate any memory.
+	// Each error sink raises at most one event.
+	_stateEvents.reserve(std::size_t(std::ranges::distance(_errorSinks)));
+
+	// Sort the write sinks by write group and address, so that the "batchWrite" task collects dirty data points in address order,
+	// and the data points of each write group together
+	std::ranges::stable_sort(_writeSinks, {},
+		[](const WriteSink &sink) { return std::pair(sink.writeGroup(), sink.addressRange()._address); });
+	// Assign each write sink its bit in the dirty bitmap
+	for (std::size_t index = 0; index < _writeSinks.size(); ++index)
+	{
+		_writeSinks[index].get()._dirtyIndex = index;
+	}
+	_dirtyWrites = std::vector<std::atomic<std::uint64_t>>((_writeSinks.size() + kDirtyWordBits - 1) / kDirtyWordBits);
+
+	// Allocate the buffers of the "batchWrite" task up front, so that it need not allocate any memory
+	_writeBatch.reserve(_writeSinks.size());
+	_writeRanges.reserve(_writeSinks.size());
+	_writeValues.reserve(_writeSinks.size());
+	_groupWriteBatch.reserve(_writeSinks.size());
+	_groupWriteRanges.reserve(_writeSinks.size());
+	_groupWriteValues.reserve(_writeSinks.size());
+	// Each write sink raises at most two events: one for its write state, and one for its read state if it uses write-through
+	_groupWriteEvents.reserve(_writeSinks.size() * 2);
+	// Each write sink needs at most one block of its own
+	_writePlan.reserve(_writeSinks.size());
+
+	// Create the I/O thread, if requested. Each job is only ever queued once, so the queue needs room for one job per
+	// read sink (the "read" task), one per write sink (the "write" task), and the "batchRead" task, the "batchWrite" task
+	// and the state change job of the I/O component itself. Inputs are only read sinks, so they post a single job, while
+	// outputs are both, and post two.
+	if (_useIoThread)
+	{
+		_ioWorker.emplace(_readSinks.size() + _writeSinks.size() + 3);
+	}
+}
+
+auto TemplateIoComponent::performFlushTraceTask(const process::ExecutionContext &context) -> void
+{
+	// Write the spans. Errors are deliberately ignored: tracing is a diagnostic aid, and must never affect the operation
+	// of the driver. The spans are kept if the file cannot be opened, and written by the next successful flush.
+	if (_tracer)
+	{
+		_tracer->flush(_traceFile);
+	}
+}
+
+auto TemplateIoComponent::performPublishStatisticsTask(const process::ExecutionContext &context) -> void
+{
+	// Publish the throttled write counter if it changed. We do this here rather than when the writes are throttled,
+	// so that the data block is not written once per throttled write.
+	if (const auto throttledWrites = _throttledWrites.load(std::memory_order_relaxed); throttledWrites != _publishedThrottledWrites)
+	{
+		_publishedThrottledWrites = throttledWrites;
+		std::scoped_lock lock { _stateMutex };
+		publishState(context.scheduledTime());
+	}
+	// Publish the write latency and request statistics for the same reason
+	_writeLatency.publish(context.scheduledTime());
+	for (auto &&sink : _writeSinks)
+	{
+		sink.get().publishWriteStatistics(context.scheduledTime());
+	}
+	_statistics.publish(context.scheduledTime());
 }
 
 auto TemplateIoComponent::ReconnectTask::preparePreOperational(const process::ExecutionContext &context) -> Status
@@ -387,7 +1520,12 @@ auto TemplateIoComponent::ReconnectTask::preOperational(const process::Execution
 
 auto TemplateIoComponent::ReconnectTask::operational(const process::ExecutionContext &context) -> void
 {
+	// Let the task monitor time the execution
+	const auto execution = _monitor.start(context.scheduledTime());
+
 	_target.get().performReconnectTask(context);
+
+	_monitor.finish(execution);
 }
 
 auto TemplateIoComponent::ReconnectTask::preparePostOperational(const process::ExecutionContext &context) -> Status
@@ -410,4 +1548,92 @@ auto TemplateIoComponent::ReconnectTask::finishPostOperational(const process::Ex
 	_target.get().requestDisconnect(context.scheduledTime());
 }
 
+auto TemplateIoComponent::FlushTraceTask::preparePreOperational(const process::ExecutionContext &context) -> Status
+{
+	// There is nothing to prepare
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::FlushTraceTask::preOperational(const process::ExecutionContext &context) -> Status
+{
+	// Do the same as in operational
+	operational(context);
+
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::FlushTraceTask::operational(const process::ExecutionContext &context) -> void
+{
+	// Let the task monitor time the execution
+	const auto execution = _monitor.start(context.scheduledTime());
+
+	_target.get().performFlushTraceTask(context);
+
+	_monitor.finish(execution);
+}
+
+auto TemplateIoComponent::FlushTraceTask::preparePostOperational(const process::ExecutionContext &context) -> Status
+{
+	// Everything in the post operational stage is optional, so we can report ready right away
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::FlushTraceTask::postOperational(const process::ExecutionContext &context) -> Status
+{
+	// We just do the same thing as in the operational stage
+	operational(context);
+
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::FlushTraceTask::finishPostOperational(const process::ExecutionContext &context) -> void
+{
+	// Write any remaining spans
+	operational(context);
+}
+
+auto TemplateIoComponent::PublishStatisticsTask::preparePreOperational(const process::ExecutionContext &context) -> Status
+{
+	// There is nothing to prepare
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::PublishStatisticsTask::preOperational(const process::ExecutionContext &context) -> Status
+{
+	// Do the same as in operational
+	operational(context);
+
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::PublishStatisticsTask::operational(const process::ExecutionContext &context) -> void
+{
+	// Let the task monitor time the execution
+	const auto execution = _monitor.start(context.scheduledTime());
+
+	_target.get().performPublishStatisticsTask(context);
+
+	_monitor.finish(execution);
+}
+
+auto TemplateIoComponent::PublishStatisticsTask::preparePostOperational(const process::ExecutionContext &context) -> Status
+{
+	// Everything in the post operational stage is optional, so we can report ready right away
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::PublishStatisticsTask::postOperational(const process::ExecutionContext &context) -> Status
+{
+	// We just do the same thing as in the operational stage
+	operational(context);
+
+	return Status::Ready;
+}
+
+auto TemplateIoComponent::PublishStatisticsTask::finishPostOperational(const process::ExecutionContext &context) -> void
+{
+	// Publish the final values
+	operational(context);
+}
+
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
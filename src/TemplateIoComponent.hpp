@@ -3,20 +3,45 @@
 
 #include "Attributes.hpp"
 #include "CustomError.hpp"
+#include "Handle.hpp"
+#include "IoStatistics.hpp"
+#include "IoWorker.hpp"
+#include "ReadTask.hpp"
+#include "ReconnectGovernor.hpp"
+#include "RequestPlan.hpp"
+#include "TaskMonitor.hpp"
+#include "Tracer.hpp"
+#include "TokenBucket.hpp"
+#include "TransactionWindow.hpp"
+#include "WriteLatencyState.hpp"
+#include "WriteTask.hpp"
 
 #include <xentara/memory/Array.hpp>
 #include <xentara/memory/ObjectBlock.hpp>
 #include <xentara/model/ElementCategory.hpp>
 #include <xentara/process/Event.hpp>
+#include <xentara/process/EventList.hpp>
 #include <xentara/process/Task.hpp>
 #include <xentara/skill/Element.hpp>
 #include <xentara/skill/EnableSharedFromThis.hpp>
 #include <xentara/utils/core/Uuid.hpp>
-#include <xentara/utils/tools/Unique.hpp>
+#include <xentara/utils/eh/expected.hpp>
 
 #include <string_view>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <forward_list>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 namespace xentara::plugins::templateDriver
 {
@@ -36,18 +61,14 @@ public:
 		"deadbeef-dead-beef-dead-beefdeadbeef"_uuid,
 		"template driver I/O component">;
 
-	/// @brief A handle used to access the I/O component
-	/// @todo implement a proper handle
-	class Handle final : private utils::tools::Unique
+	/// @brief This constructor attaches the I/O component to the governor that limits concurrent connection attempts
+	TemplateIoComponent(std::reference_wrapper<ReconnectGovernor> reconnectGovernor) :
+		_reconnectGovernor(reconnectGovernor)
 	{
-	public:
-		/// @brief determines of the I/O component is connected
-		explicit operator bool() const noexcept
-		{
-			/// @todo return the actual state
-			return false;
-		}
-	};
+	}
+
+	/// @brief Destructor
+	~TemplateIoComponent();
 
 	/// @brief Interface for objects that want to be notified of errors
 	class ErrorSink
@@ -71,6 +92,99 @@ public:
 		///
 		/// @todo give this a more descriptive name, e.g. "deviceStateChanged"
 		virtual auto ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void = 0;
+
+		/// @brief Called on error, or on success, if the I/O component batches state changes.
+		///
+		/// This function is called instead of the other overload if the I/O component is configured to batch state changes.
+		/// The error sink must not raise any events itself, but append them to the event list instead. The I/O component
+		/// raises the events of all error sinks together once all of them have been updated.
+		///
+		/// The function is not called from within requestConnect() or handleError(), but later, from the I/O thread of
+		/// the I/O component, or from its "reconnect" task.
+		virtual auto ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp,
+			std::error_code error,
+			process::DynamicEventList &events) -> void = 0;
+	};
+
+	/// @brief Interface for data points that can be read in a batch by the I/O component
+	class ReadSink
+	{
+	public:
+		/// @brief Virtual destructor
+		/// @note The destructor is pure virtual (= 0) to ensure that this class will remain abstract, even if we should remove all
+		/// other pure virtual functions later.
+		virtual ~ReadSink() = 0;
+
+		/// @brief Gets the device addresses occupied by the data point
+		virtual auto addressRange() const noexcept -> AddressRange = 0;
+
+		/// @brief Called by the I/O component when the data point was read as part of a batch.
+		/// @param timeStamp The update time stamp
+		/// @param valueOrError The value that was read, or an std::error_code object containing the read error for this data point
+		/// @todo use the correct value type
+		virtual auto batchReadCompleted(std::chrono::system_clock::time_point timeStamp,
+			const utils::eh::expected<double, std::error_code> &valueOrError) -> void = 0;
+	};
+
+	/// @brief Interface for data points that can be written in a batch by the I/O component
+	class WriteSink
+	{
+	public:
+		/// @brief Virtual destructor
+		/// @note The destructor is pure virtual (= 0) to ensure that this class will remain abstract, even if we should remove all
+		/// other pure virtual functions later.
+		virtual ~WriteSink() = 0;
+
+		/// @brief Gets the device addresses occupied by the data point
+		virtual auto addressRange() const noexcept -> AddressRange = 0;
+
+		/// @brief Gets the write group of the data point.
+		///
+		/// All the data points of a write group that have pending values are written together using a single transaction.
+		/// @return The ID of the write group, or 0 if the data point does not belong to a write group
+		virtual auto writeGroup() const noexcept -> std::uint32_t = 0;
+
+		/// @brief Called by the I/O component to get the value to write as part of a batch.
+		/// @param timeStamp The write time stamp
+		/// @return The pending value, or std::nullopt if there is none, e.g. because it was already written by the data point
+		/// itself, or because the data point does not need to be written
+		/// @todo use the correct value type
+		virtual auto dequeueBatchWriteValue(std::chrono::system_clock::time_point timeStamp) -> std::optional<double> = 0;
+
+		/// @brief Called by the I/O component if a value gotten from dequeueBatchWriteValue() could not be sent yet.
+		///
+		/// The value must be kept pending, so that the next batch write sends it. If a newer value was scheduled in the meantime,
+		/// the newer value wins.
+		virtual auto restoreBatchWriteValue() noexcept -> void = 0;
+
+		/// @brief Called by the I/O component when the data point was written as part of a batch.
+		/// @param timeStamp The write time stamp
+		/// @param error The error code, or a default constructed std::error_code object if the value was written successfully
+		virtual auto batchWriteCompleted(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void = 0;
+
+		/// @brief Called by the I/O component when the data point was written as part of a write group transaction.
+		///
+		/// The write sink must not raise any events itself, but append them to the event list instead. The I/O component
+		/// raises the events of all the data points in the write group together.
+		/// @param timeStamp The write time stamp
+		/// @param error The error code, or a default constructed std::error_code object if the transaction was successful
+		/// @param events The list to append the events to
+		virtual auto batchWriteCompleted(std::chrono::system_clock::time_point timeStamp,
+			std::error_code error,
+			process::DynamicEventList &events) -> void = 0;
+
+		/// @brief Called periodically by the I/O component to publish the write statistics of the data point.
+		///
+		/// The statistics are published here rather than on every write, so that the data block is not written once per write.
+		/// @param timeStamp The update time stamp
+		virtual auto publishWriteStatistics(std::chrono::system_clock::time_point timeStamp) -> void = 0;
+
+	private:
+		/// @brief The I/O component needs access to the private members
+		friend class TemplateIoComponent;
+
+		/// @brief The index of the data point in the dirty bitmap of the I/O component
+		std::size_t _dirtyIndex { 0 };
 	};
 
 	/// @brief Adds an error sink
@@ -79,6 +193,31 @@ public:
 		_errorSinks.push_front(sink);
 	}
 
+	/// @brief Adds a read sink that will be read by the "batchRead" task
+	///
+	/// All read sinks must be added before the I/O component is realized.
+	auto addReadSink(std::reference_wrapper<ReadSink> sink)
+	{
+		_readSinks.push_back(sink);
+	}
+
+	/// @brief Adds a write sink that will be written by the "batchWrite" task
+	///
+	/// All write sinks must be added before the I/O component is realized.
+	auto addWriteSink(std::reference_wrapper<WriteSink> sink)
+	{
+		_writeSinks.push_back(sink);
+	}
+
+	/// @brief Marks a write sink as having a pending value, so that the next execution of the "batchWrite" task will write it.
+	///
+	/// This function is lock-free and may be called from any thread, but only after the I/O component was realized.
+	auto markWriteDirty(const WriteSink &sink) noexcept -> void
+	{
+		_dirtyWrites[sink._dirtyIndex / kDirtyWordBits].fetch_or(
+			std::uint64_t(1) << (sink._dirtyIndex % kDirtyWordBits), std::memory_order_release);
+	}
+
 	/// @brief Request that the I/O component be connected.
 	///
 	/// Each call to this function must be balanced by a call to requestDisconnect().
@@ -86,6 +225,9 @@ public:
 	/// If this is the first request, then the connection will be attempted, and the function will not return until
 	/// the connection has been successfully established, or has failed. In either case, error sinks will be notified,
 	/// so any error sinks calling this must be prepared to have ioComponentStateChanged() called from within this function.
+	/// 
+	/// If asynchronous connection is enabled, the connection attempt is only started by this function, and the function
+	/// returns immediately. Error sinks will then be notified from a background thread when the attempt has completed.
 	auto requestConnect(std::chrono::system_clock::time_point timeStamp) noexcept -> void;
 
 	/// @brief Request that the I/O component be disconnected.
@@ -103,10 +245,57 @@ public:
 	/// and does not whish to be notified, but intends to handle the error itself instead, it can pass a pointer to itself as the sender parameter. 
 	auto handleError(std::chrono::system_clock::time_point timeStamp, std::error_code error, const ErrorSink *sender = nullptr) noexcept -> void;
 
+	/// @brief Checks whether an error is the result of a lost connection
+	static auto isConnectionError(std::error_code error) noexcept -> bool;
+
+	/// @brief Asks the write rate limiter for permission to send a write request to the device.
+	///
+	/// This function never blocks. If permission is denied, the caller must leave its values pending, and try again later.
+	/// @return true if the request may be sent, or false if it must be deferred
+	auto tryAcquireWriteToken() -> bool
+	{
+		if (_writeLimiter.tryAcquire())
+		{
+			return true;
+		}
+
+		_throttledWrites.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	/// @brief Gives back the permission gotten from tryAcquireWriteToken() if no request was sent after all
+	auto refundWriteToken() -> void
+	{
+		_writeLimiter.refund();
+	}
+
+	/// @brief Gets the write latency statistics of the I/O component.
+	///
+	/// Data points record the latencies of their own writes here, so that the I/O component has statistics for all writes.
+	auto writeLatency() noexcept -> WriteLatencyState &
+	{
+		return _writeLatency;
+	}
+
+	/// @brief Gets the tracer that driver operations of the I/O component and its data points should be recorded on
+	/// @return The tracer, or nullptr if tracing is disabled
+	auto tracer() noexcept -> Tracer *
+	{
+		return _tracer ? &*_tracer : nullptr;
+	}
+
+	/// @brief Gets the request statistics of the I/O component.
+	///
+	/// Data points record their own requests here. Errors reported using handleError() are counted automatically.
+	auto statistics() noexcept -> IoStatistics &
+	{
+		return _statistics;
+	}
+
 	/// @brief Checks whether the I/O component is up
 	auto connected() const -> bool
 	{
-		return bool(_handle);
+		return _connectionState.load(std::memory_order_acquire) == ConnectionState::Connected;
 	}
 
 	/// @brief Returns a handle to the I/O component
@@ -115,6 +304,14 @@ public:
 		return _handle;
 	}
 
+	/// @brief Returns the I/O thread of the I/O component
+	/// @return The I/O thread that all I/O should be handed to, or nullptr if I/O should be performed directly on the
+	/// calling thread
+	auto ioWorker() noexcept -> IoWorker *
+	{
+		return _ioWorker ? &*_ioWorker : nullptr;
+	}
+
 	/// @name Virtual Overrides for skill::Element
 	/// @{
 
@@ -137,6 +334,17 @@ public:
 	/// @}
 
 private:
+	/// @brief The state of the connection to the I/O component
+	enum class ConnectionState
+	{
+		/// @brief The I/O component is not connected, and no connection attempt is in progress
+		Disconnected,
+		/// @brief A connection attempt is in progress
+		Connecting,
+		/// @brief The I/O component is connected
+		Connected
+	};
+
 	/// @brief This structure represents the current state of the I/O component
 	struct State
 	{
@@ -146,6 +354,60 @@ private:
 		std::chrono::system_clock::time_point _connectionTime { std::chrono::system_clock::time_point::min() };
 		/// @brief The error code when connecting, or a default constructed std::error_code object for none.
 		std::error_code _error { CustomError::NotConnected };
+		/// @brief The number of failed reconnect attempts since the component was last connected
+		std::uint64_t _reconnectAttempts { 0 };
+		/// @brief The earliest time the next reconnect will be attempted
+		std::chrono::system_clock::time_point _nextReconnectTime { std::chrono::system_clock::time_point::min() };
+		/// @brief The number of I/O components that were still waiting when the last connection attempt was allowed
+		std::uint64_t _reconnectQueueDepth { 0 };
+		/// @brief How long the last connection attempt had to wait before it was allowed
+		std::chrono::nanoseconds _reconnectWaitTime { 0 };
+		/// @brief The number of writes that were deferred by the write rate limit
+		std::uint64_t _throttledWrites { 0 };
+	};
+
+	/// @brief An outstanding block request of the "batchRead" task
+	struct ReadTransaction final
+	{
+		/// @brief The index of the block in the request plan
+		std::size_t _blockIndex { 0 };
+		/// @brief The time the request was sent
+		std::chrono::steady_clock::time_point _sendTime;
+	};
+
+	/// @brief A change of the connection state that has not been passed on to the error sinks yet
+	struct StateChange final
+	{
+		/// @brief The time stamp of the change
+		std::chrono::system_clock::time_point _timeStamp;
+		/// @brief The new error, or a default constructed std::error_code object if the I/O component was connected
+		std::error_code _error;
+		/// @brief An error sink that handles the error itself, and must not be notified, or nullptr
+		const ErrorSink *_excludeErrorSink { nullptr };
+	};
+
+	/// @brief A job that passes batched state changes on to the error sinks on the I/O thread
+	class StateChangeJob final : public IoWorker::Job
+	{
+	public:
+		/// @brief This constuctor attached the job to its target
+		StateChangeJob(std::reference_wrapper<TemplateIoComponent> target) : _target(target)
+		{
+		}
+
+		/// @name Virtual Overrides for IoWorker::Job
+		/// @{
+
+		auto execute(std::chrono::system_clock::time_point) -> void final
+		{
+			_target.get().deliverStateChange();
+		}
+
+		/// @}
+
+	private:
+		/// @brief A reference to the target element
+		std::reference_wrapper<TemplateIoComponent> _target;
 	};
 
 	/// @brief This class providing callbacks for the Xentara scheduler for the "reconnect" task
@@ -153,10 +415,72 @@ private:
 	{
 	public:
 		/// @brief This constuctor attached the task to its target
-		ReconnectTask(std::reference_wrapper<TemplateIoComponent> target) : _target(target)
+		ReconnectTask(std::reference_wrapper<TemplateIoComponent> target) : _target(target), _monitor(TaskMonitor::kReconnectRoles)
+		{
+		}
+
+		/// @brief Gets the task monitor of the task
+		auto monitor() noexcept -> TaskMonitor &
+		{
+			return _monitor;
+		}
+
+		/// @brief Gets the task monitor of the task
+		auto monitor() const noexcept -> const TaskMonitor &
+		{
+			return _monitor;
+		}
+
+		/// @name Virtual Overrides for process::Task
+		/// @{
+
+		auto stages() const -> Stages final
+		{
+			return Stage::PreOperational | Stage::Operational | Stage::PostOperational;
+		}
+
+		auto preparePreOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto preOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto operational(const process::ExecutionContext &context) -> void final;
+
+		auto preparePostOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto postOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto finishPostOperational(const process::ExecutionContext &context) -> void final;
+
+		/// @}
+
+	private:
+		/// @brief A reference to the target element
+		std::reference_wrapper<TemplateIoComponent> _target;
+		/// @brief The task monitor
+		TaskMonitor _monitor;
+	};
+
+	/// @brief This class providing callbacks for the Xentara scheduler for the "flushTrace" task
+	class FlushTraceTask final : public process::Task
+	{
+	public:
+		/// @brief This constuctor attached the task to its target
+		FlushTraceTask(std::reference_wrapper<TemplateIoComponent> target) : _target(target), _monitor(TaskMonitor::kFlushTraceRoles)
 		{
 		}
 
+		/// @brief Gets the task monitor of the task
+		auto monitor() noexcept -> TaskMonitor &
+		{
+			return _monitor;
+		}
+
+		/// @brief Gets the task monitor of the task
+		auto monitor() const noexcept -> const TaskMonitor &
+		{
+			return _monitor;
+		}
+
 		/// @name Virtual Overrides for process::Task
 		/// @{
 
@@ -182,17 +506,170 @@ private:
 	private:
 		/// @brief A reference to the target element
 		std::reference_wrapper<TemplateIoComponent> _target;
+		/// @brief The task monitor
+		TaskMonitor _monitor;
+	};
+
+	/// @brief This class providing callbacks for the Xentara scheduler for the "publishStatistics" task
+	class PublishStatisticsTask final : public process::Task
+	{
+	public:
+		/// @brief This constuctor attached the task to its target
+		PublishStatisticsTask(std::reference_wrapper<TemplateIoComponent> target) : _target(target), _monitor(TaskMonitor::kPublishStatisticsRoles)
+		{
+		}
+
+		/// @brief Gets the task monitor of the task
+		auto monitor() noexcept -> TaskMonitor &
+		{
+			return _monitor;
+		}
+
+		/// @brief Gets the task monitor of the task
+		auto monitor() const noexcept -> const TaskMonitor &
+		{
+			return _monitor;
+		}
+
+		/// @name Virtual Overrides for process::Task
+		/// @{
+
+		auto stages() const -> Stages final
+		{
+			return Stage::PreOperational | Stage::Operational | Stage::PostOperational;
+		}
+
+		auto preparePreOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto preOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto operational(const process::ExecutionContext &context) -> void final;
+
+		auto preparePostOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto postOperational(const process::ExecutionContext &context) -> Status final;
+
+		auto finishPostOperational(const process::ExecutionContext &context) -> void final;
+
+		/// @}
+
+	private:
+		/// @brief A reference to the target element
+		std::reference_wrapper<TemplateIoComponent> _target;
+		/// @brief The task monitor
+		TaskMonitor _monitor;
 	};
 	
+	/// @brief The "batchRead" task needs access to out private member functions
+	friend class ReadTask<TemplateIoComponent>;
+	/// @brief The "batchWrite" task needs access to out private member functions
+	friend class WriteTask<TemplateIoComponent>;
+
+	/// @brief Attempts to read all the data points if the I/O component is up.
+	///
+	/// This function is called either by the "batchRead" task, or on the I/O thread.
+	auto performRead(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Reads the data of all read sinks from the I/O component using the precomputed request plan, and passes the results on.
+	///
+	/// Up to _maxOutstandingRequests block requests are kept in flight at the same time. The connection is dropped if the
+	/// responses take longer than _batchReadTimeout, or too many responses cannot be matched to a request, so that late
+	/// responses cannot be mistaken for responses to later requests.
+	auto batchRead(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Sends the request for a single block of the request plan without waiting for the response
+	auto sendBlockRequest(std::chrono::system_clock::time_point timeStamp, std::size_t blockIndex) -> void;
+	/// @brief Receives the response to one of the outstanding block requests and passes the results on
+	/// @return false if the response did not belong to any outstanding request, or true otherwise
+	auto receiveBlockResponse(std::chrono::system_clock::time_point timeStamp) -> bool;
+	/// @brief Gets the read sinks belonging to a block of the request plan
+	auto blockSinks(const RequestPlan::Block &block) const noexcept -> std::span<const std::reference_wrapper<ReadSink>>
+	{
+		return std::span(_readSinks).subspan(block._begin, block._end - block._begin);
+	}
+	/// @brief Records the round trip time, sizes and fill ratio of a block read request
+	auto recordBlockRead(const RequestPlan::Block &block, std::chrono::nanoseconds roundTrip) noexcept -> void;
+	/// @brief Handles an error that affected an entire block request
+	auto handleBatchReadError(std::chrono::system_clock::time_point timeStamp,
+		std::error_code error,
+		std::span<const std::reference_wrapper<ReadSink>> sinks) -> void;
+
+	/// @brief Attempts to write all the pending values if the I/O component is up.
+	///
+	/// This function is called either by the "batchWrite" task, or on the I/O thread.
+	auto performWrite(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Collects the pending values of all dirty write sinks, and writes them using as few requests as possible
+	auto batchWrite(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Writes a single block of the current write plan
+	auto writeBlock(std::chrono::system_clock::time_point timeStamp, const RequestPlan::Block &block) -> void;
+	/// @brief Gets the write sinks belonging to a block of the current write plan
+	auto blockWriteSinks(const RequestPlan::Block &block) const noexcept -> std::span<const std::reference_wrapper<WriteSink>>
+	{
+		return std::span(_writeBatch).subspan(block._begin, block._end - block._begin);
+	}
+	/// @brief Writes the data points of a single write group in a single transaction
+	/// @param timeStamp The write time stamp
+	/// @param begin The index in _groupWriteBatch of the first data point of the group
+	/// @param end The index in _groupWriteBatch one past the last data point of the group
+	auto writeGroupTransaction(std::chrono::system_clock::time_point timeStamp, std::size_t begin, std::size_t end) -> void;
+	/// @brief Hands the values of write sinks back to them, and marks them dirty, so that the next batch write sends them
+	auto deferBatchWrite(std::span<const std::reference_wrapper<WriteSink>> sinks) noexcept -> void;
+	/// @brief Handles an error that affected an entire block write
+	auto handleBatchWriteError(std::chrono::system_clock::time_point timeStamp,
+		std::error_code error,
+		std::span<const std::reference_wrapper<WriteSink>> sinks) -> void;
+
 	/// @brief This function is called by the "reconnect" task.
 	///
 	/// This function attempts to reconnect any disconnected I/O components.
 	auto performReconnectTask(const process::ExecutionContext &context) -> void;
 
-	/// @brief Attempts to establish a connection to the I/O component and updates the state accordingly.
+	/// @brief This function is called by the "flushTrace" task.
+	///
+	/// This function writes all the spans recorded since the last call to the trace file.
+	auto performFlushTraceTask(const process::ExecutionContext &context) -> void;
+
+	/// @brief This function is called by the "publishStatistics" task.
+	///
+	/// This function publishes the counters and statistics that are collected using relaxed atomic operations.
+	auto performPublishStatisticsTask(const process::ExecutionContext &context) -> void;
+
+	/// @brief Starts a connection attempt, unless the I/O component is already connected or connecting.
+	///
+	/// The attempt is only started if the reconnect governor allows it. Otherwise, the I/O component stays queued,
+	/// and the "reconnect" task will try again later.
+	/// 
+	/// If asynchronous connection is enabled, the connection attempt is handed to the connect thread, and this function returns
+	/// immediately. Otherwise, this function will notify error sinks if anything changes.
+	auto startConnect(std::chrono::system_clock::time_point timeStamp) -> void;
+
+	/// @brief Starts the I/O thread and the connect thread, if they are used and not running yet.
+	///
+	/// This is called by startConnect() once it has claimed the connection attempt, so it is never called twice at once.
+	/// The threads are stopped again by requestDisconnect().
+	/// @return The error that prevented a thread from starting, or a default constructed std::error_code object on success
+	auto startThreads() noexcept -> std::error_code;
+
+	/// @brief The main function of the thread that makes asynchronous connection attempts
+	auto runConnectThread(std::stop_token stopToken) -> void;
+
+	/// @brief Stops the connect thread, waiting for any connection attempt in progress to complete
+	auto stopConnectThread() -> void;
+
+	/// @brief Attempts to establish a connection to the I/O component.
+	/// @return A default constructed std::error_code object on success, or the error that occurred
+	auto connect() -> std::error_code;
+
+	/// @brief Updates the connection state after a connection attempt has completed.
 	///
 	/// This function will notify error sinks if anything changes.
-	auto connect(std::chrono::system_clock::time_point timeStamp) -> void;
+	auto finishConnect(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
+
+	/// @brief Schedules the next reconnect attempt after a connection attempt has completed
+	/// @note _stateMutex must be locked when calling this function
+	auto scheduleReconnect(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
+
+	/// @brief Calculates the delay before the next reconnect attempt, including jitter
+	/// @param attempts The number of failed attempts so far. Must not be 0.
+	auto reconnectDelay(std::uint64_t attempts) -> std::chrono::system_clock::duration;
 
 	/// @brief Terminates the connection to the I/O component and updates the state accordingly.
 	///
@@ -200,10 +677,32 @@ private:
 	auto disconnect(std::chrono::system_clock::time_point timeStamp) -> void;
 
 	/// @brief Updates the state and sends events
+	///
+	/// If state changes are batched, the error sinks are not notified by this function, but by deliverStateChange().
+	/// @note _stateMutex must be locked when calling this function
 	auto updateState(std::chrono::system_clock::time_point timeStamp, std::error_code error, const ErrorSink *excludeErrorSink = nullptr) -> void;
 
-	/// @brief Checks whether an error is the result of a lost connection
-	static auto isConnectionError(std::error_code error) noexcept -> bool;
+	/// @brief Passes the latest batched state change on to all the error sinks, and raises their events together.
+	///
+	/// This is called on the I/O thread if there is one, and by the "reconnect" task and disconnect() otherwise, so that
+	/// data points reporting an error need not wait for all the other data points to be updated.
+	/// @note _stateMutex must not be locked when calling this function
+	auto deliverStateChange() -> void;
+
+	/// @brief Publishes a changed reconnect schedule, governor information, and counters without changing the rest of the state
+	/// @note _stateMutex must be locked when calling this function
+	auto publishState(std::chrono::system_clock::time_point timeStamp) -> void;
+
+	/// @brief Publishes the same information as the other overload, and raises events on behalf of the data points
+	/// @note _stateMutex must be locked when calling this function
+	auto publishState(std::chrono::system_clock::time_point timeStamp, const process::DynamicEventList &events) -> void;
+
+	/// @brief Counts an error in the statistics
+	auto countError(std::error_code error) noexcept -> void;
+
+	/// @brief Checks whether an error means that a reconnect cannot succeed until the system is changed, e.g. because required
+	/// hardware is missing
+	static auto isPermanentError(std::error_code error) noexcept -> bool;
 
 	/// @name Virtual Overrides for skill::Element
 	/// @{
@@ -221,13 +720,140 @@ private:
 
 	/// @brief The "reconnect" task
 	ReconnectTask _reconnectTask { *this };
+	/// @brief The "batchRead" task
+	ReadTask<TemplateIoComponent> _batchReadTask { *this, TaskMonitor::kBatchReadRoles };
+	/// @brief The "batchWrite" task
+	WriteTask<TemplateIoComponent> _batchWriteTask { *this, TaskMonitor::kBatchWriteRoles };
+	/// @brief The "flushTrace" task
+	FlushTraceTask _flushTraceTask { *this };
+	/// @brief The "publishStatistics" task
+	PublishStatisticsTask _publishStatisticsTask { *this };
+	/// @brief The job that passes batched state changes on to the error sinks on the I/O thread
+	StateChangeJob _stateChangeJob { *this };
 
 	/// @brief A list of objects that want to be notified of errors
 	std::forward_list<std::reference_wrapper<ErrorSink>> _errorSinks;
+	/// @brief The data points that are read by the "batchRead" task.
+	/// 
+	/// This list is sorted by address when the I/O component is realized.
+	std::vector<std::reference_wrapper<ReadSink>> _readSinks;
+
+	/// @brief The largest number of unused address units that may be read to merge two neighbouring read requests
+	std::uint32_t _maxRequestGap { 0 };
+	/// @brief The largest number of address units that can be read using a single request
+	/// @todo set this to the maximum request size supported by the device
+	std::uint32_t _maxRequestSize { 128 };
+
+	/// @brief The precomputed plan for the "batchRead" task
+	RequestPlan _readPlan;
+	/// @brief A buffer for the response of a single block request, preallocated to fit the largest block
+	std::vector<std::byte> _readBuffer;
+
+	/// @brief The number of write sinks in each word of the dirty bitmap
+	static constexpr std::size_t kDirtyWordBits = 64;
+
+	/// @brief The data points that are written by the "batchWrite" task.
+	/// 
+	/// This list is sorted by address when the I/O component is realized.
+	std::vector<std::reference_wrapper<WriteSink>> _writeSinks;
+	/// @brief A bitmap of the write sinks that have pending values, indexed by WriteSink::_dirtyIndex.
+	/// @note The bits of the data points of each write group are next to each other.
+	std::vector<std::atomic<std::uint64_t>> _dirtyWrites;
+	/// @brief The write sinks whose values are being written by the current execution of the "batchWrite" task, in address order
+	std::vector<std::reference_wrapper<WriteSink>> _writeBatch;
+	/// @brief The address ranges of the data points in _writeBatch
+	std::vector<AddressRange> _writeRanges;
+	/// @brief The values of the data points in _writeBatch
+	/// @todo use the correct value type
+	std::vector<double> _writeValues;
+	/// @brief The plan for the current execution of the "batchWrite" task
+	RequestPlan _writePlan;
+	/// @brief The write sinks that belong to write groups and are being written by the current execution of the "batchWrite" task.
+	///
+	/// The members of each group are stored next to each other, because the write sinks are sorted by group.
+	std::vector<std::reference_wrapper<WriteSink>> _groupWriteBatch;
+	/// @brief The address ranges of the data points in _groupWriteBatch
+	std::vector<AddressRange> _groupWriteRanges;
+	/// @brief The values of the data points in _groupWriteBatch
+	/// @todo use the correct value type
+	std::vector<double> _groupWriteValues;
+	/// @brief The events of the data points of a write group, which are raised together
+	process::DynamicEventList _groupWriteEvents;
+
+	/// @brief The maximum number of write requests per second, or 0 for no limit
+	double _writeRate { 0 };
+	/// @brief The number of write requests that may be sent in a burst if the limit was not reached for a while
+	double _writeBurst { 1 };
+	/// @brief The limiter for the write requests
+	TokenBucket _writeLimiter;
+	/// @brief The number of writes that were deferred by the write rate limit
+	std::atomic<std::uint64_t> _throttledWrites { 0 };
+	/// @brief The value of _throttledWrites last published in the data block
+	std::uint64_t _publishedThrottledWrites { 0 };
+
+	/// @brief The write latency statistics for all writes to the I/O component
+	WriteLatencyState _writeLatency;
+	/// @brief The request statistics
+	IoStatistics _statistics;
+
+	/// @brief The file the "flushTrace" task writes the recorded spans to, or an empty path if tracing is disabled
+	std::filesystem::path _traceFile;
+	/// @brief The tracer, if tracing is enabled
+	std::optional<Tracer> _tracer;
+
+	/// @brief The length of the sliding window of the request statistics
+	std::chrono::milliseconds _statisticsWindow { 10s };
+
+	/// @brief The maximum number of block requests that may be in flight on the connection at the same time
+	std::size_t _maxOutstandingRequests { 1 };
+	/// @brief The outstanding block requests of the "batchRead" task
+	TransactionWindow<ReadTransaction> _readTransactions;
+	/// @brief The longest time the "batchRead" task waits for the responses of a single execution
+	std::chrono::milliseconds _batchReadTimeout { 1s };
 
 	/// @brief The number of people who would like this component to be connected
 	std::atomic<std::size_t> _connectionRequestCount { 0 };
 
+	/// @brief Whether to establish connections on a background thread
+	bool _asynchronousConnect { false };
+	/// @brief Whether to perform all I/O on a dedicated I/O thread
+	bool _useIoThread { false };
+	/// @brief Whether to raise the events of all error sinks together when the state changes
+	bool _batchStateChanges { false };
+
+	/// @brief The delay before the first reconnect attempt after a failed connection attempt, or 0 to reconnect on every
+	/// execution of the "reconnect" task. The delay is doubled after each failed attempt.
+	std::chrono::milliseconds _reconnectDelay { 0 };
+	/// @brief The maximum delay between reconnect attempts, which is also used after errors that cannot go away by themselves
+	std::chrono::milliseconds _maxReconnectDelay { 60s };
+	/// @brief The fraction by which the reconnect delay is randomly shortened, so that components do not reconnect in lockstep
+	double _reconnectJitter { 0.0 };
+	/// @brief The random number engine used for the jitter
+	std::minstd_rand _jitterEngine { std::random_device()() };
+
+	/// @brief The governor that limits the number of concurrent connection attempts
+	std::reference_wrapper<ReconnectGovernor> _reconnectGovernor;
+	/// @brief Our place in the queue of the reconnect governor
+	ReconnectGovernor::Waiter _reconnectWaiter;
+	/// @brief Information about the last connection attempt granted by the reconnect governor.
+	/// @note This is protected by _stateMutex, because it is published with the state
+	ReconnectGovernor::Grant _reconnectGrant;
+
+	/// @brief The number of failed reconnect attempts since the component was last connected
+	std::uint64_t _reconnectAttempts { 0 };
+	/// @brief The earliest time the next reconnect will be attempted
+	std::chrono::system_clock::time_point _nextReconnectTime { std::chrono::system_clock::time_point::min() };
+	/// @brief The state of the connection.
+	///
+	/// This is set to ConnectionState::Connected only after the handle was set, so that other threads will see a valid handle.
+	std::atomic<ConnectionState> _connectionState { ConnectionState::Disconnected };
+
+	/// @brief A mutex protecting _handle, _lastError, and the state data block.
+	///
+	/// These are changed by handleError(), which data points may call from any thread. While a connection attempt is in
+	/// progress, _handle belongs to the attempt, and handleError() leaves it alone, because we are not connected.
+	std::mutex _stateMutex;
+
 	/// @brief A handle to the I/O component
 	Handle _handle;
 	/// @brief The last error we encountered.
@@ -237,11 +863,43 @@ private:
 	/// - If the connection was closed gracefully, this will be CustomError::NotConnected;
 	/// - Otherwise, this will contain an appropriate error code
 	std::error_code _lastError { CustomError::NotConnected };
+	/// @brief The latest batched state change that has not been passed on to the error sinks yet.
+	/// @note This is protected by _stateMutex
+	std::optional<StateChange> _pendingStateChange;
+
+	/// @brief A mutex that keeps two threads from passing state changes on to the error sinks at the same time, and protects
+	/// _stateEvents. If both are needed, this must be locked first. It is not held while _stateMutex is locked, so errors can be
+	/// reported while the error sinks are being updated.
+	std::mutex _stateChangeMutex;
+	/// @brief The events collected by deliverStateChange().
+	/// @note This is preallocated in realize(), so that state changes need not allocate any memory.
+	process::DynamicEventList _stateEvents;
 
 	/// @brief The data block that contains the state
 	memory::ObjectBlock<State> _stateDataBlock;
+
+	/// @brief The I/O thread, if enabled.
+	/// @note This must come after all the members used by the jobs it executes, so that the thread is joined before they are destroyed.
+	std::optional<IoWorker> _ioWorker;
+
+	/// @brief A mutex protecting _connectRequested
+	std::mutex _connectMutex;
+	/// @brief Used to wake up the connect thread when a connection attempt is requested
+	std::condition_variable_any _connectCondition;
+	/// @brief Whether a connection attempt was handed to the connect thread, but not started yet
+	bool _connectRequested { false };
+
+	/// @brief The thread that makes asynchronous connection attempts, if enabled.
+	///
+	/// The thread runs for as long as a connection is requested, so that the attempts need not create a thread each.
+	/// @note This must be the last member, so that the thread is joined before any data it uses is destroyed.
+	std::jthread _connectThread;
 };
 
 inline TemplateIoComponent::ErrorSink::~ErrorSink() = default;
 
+inline TemplateIoComponent::ReadSink::~ReadSink() = default;
+
+inline TemplateIoComponent::WriteSink::~WriteSink() = default;
+
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
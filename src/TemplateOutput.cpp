@@ -17,6 +17,8 @@
 #include <xentara/utils/json/decoder/Errors.hpp>
 #include <xentara/utils/eh/currentErrorCode.hpp>
 
+#include <string>
+
 namespace xentara::plugins::templateDriver
 {
 	
@@ -26,11 +28,79 @@ const model::Attribute TemplateOutput::kValueAttribute { model::Attribute::kValu
 
 auto TemplateOutput::load(utils::json::decoder::Object &jsonObject, config::Context &context) -> void
 {
+	// Keep track of which mandatory parameters were found
+	bool addressLoaded = false;
+
+	// The report by exception settings are collected here, and set on the read state afterwards
+	bool reportByException = false;
+	std::chrono::nanoseconds heartbeatInterval { 0 };
+
 	// Go through all the members of the JSON object that represents this object
 	for (auto && [name, value] : jsonObject)
     {
+		if (name == "address"sv)
+		{
+			_addressRange._address = value.asNumber<std::uint32_t>();
+			addressLoaded = true;
+		}
+		else if (name == "splitPhaseRead"sv)
+		{
+			_splitPhaseRead = value.asBool();
+		}
+		else if (name == "writeGroup"sv)
+		{
+			_writeGroup = value.asNumber<std::uint32_t>();
+		}
+		else if (name == "writeThrough"sv)
+		{
+			_writeThrough = value.asBool();
+		}
+		else if (name == "readBackOnWrite"sv)
+		{
+			_readBackOnWrite = value.asBool();
+		}
+		else if (name == "writeOnChange"sv)
+		{
+			_writeOnChange = value.asBool();
+		}
+		else if (name == "writeRefreshInterval"sv)
+		{
+			_writeRefreshInterval = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+		}
+		else if (name == "writeQueueSize"sv)
+		{
+			_writeQueueSize = value.asNumber<std::size_t>();
+		}
+		else if (name == "writeQueueOverflow"sv)
+		{
+			const auto policy = value.asString<std::string>();
+			if (policy == "dropOldest"sv)
+			{
+				_queueOverflowPolicy = QueueOverflowPolicy::DropOldest;
+			}
+			else if (policy == "dropNewest"sv)
+			{
+				_queueOverflowPolicy = QueueOverflowPolicy::DropNewest;
+			}
+			else if (policy == "reject"sv)
+			{
+				_queueOverflowPolicy = QueueOverflowPolicy::Reject;
+			}
+			else
+			{
+				utils::json::decoder::throwWithLocation(value, std::runtime_error("unknown write queue overflow policy in template output"));
+			}
+		}
+		else if (name == "reportByException"sv)
+		{
+			reportByException = value.asBool();
+		}
+		else if (name == "heartbeatInterval"sv)
+		{
+			heartbeatInterval = std::chrono::milliseconds(value.asNumber<std::uint32_t>());
+		}
 		/// @todo load configuration parameters
-		if (name == "TODO"sv)
+		else if (name == "TODO"sv)
 		{
 			/// @todo parse the value correctly
 			auto todo = value.asNumber<std::uint64_t>();
@@ -50,6 +120,39 @@ auto TemplateOutput::load(utils::json::decoder::Object &jsonObject, config::Cont
 		}
     }
 
+	// Check that the address was specified
+	if (!addressLoaded)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("missing address in template output"));
+	}
+
+	// Write groups are written by the "batchWrite" task of the I/O component, which only writes a single value per data point
+	if (_writeGroup != 0 && _writeQueueSize > 0)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("template output in a write group cannot use a write queue"));
+	}
+
+	// A write queue sends every value in order, so it cannot leave out values that did not change
+	if (_writeOnChange && _writeQueueSize > 0)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("template output with a write queue cannot use write on change"));
+	}
+
+	// A write queue sends several values in a single request, which cannot be read back in the same transaction
+	if (_readBackOnWrite && _writeQueueSize > 0)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("template output with a write queue cannot use read back on write"));
+	}
+
+	// Write-through and read back both update the read state after a write, so only one of them makes sense
+	if (_writeThrough && _readBackOnWrite)
+	{
+		utils::json::decoder::throwWithLocation(jsonObject, std::runtime_error("template output cannot use both write-through and read back on write"));
+	}
+
+	// Set the report by exception settings
+	_readState.setReportByException(reportByException, heartbeatInterval);
+
 	/// @todo perform consistency and completeness checks
 	if (!"TODO")
 	{
@@ -58,7 +161,7 @@ auto TemplateOutput::load(utils::json::decoder::Object &jsonObject, config::Cont
 	}
 }
 
-auto TemplateOutput::performReadTask(const process::ExecutionContext &context) -> void
+auto TemplateOutput::performRead(std::chrono::system_clock::time_point timeStamp) -> void
 {
 	// Only perform the read only if the I/O component is connected
 	if (!_ioComponent.get().connected())
@@ -66,21 +169,49 @@ auto TemplateOutput::performReadTask(const process::ExecutionContext &context) -
 		return;
 	}
 
+	// Skip the read if the read state was just updated from a write
+	const auto skipRead = _skipNextRead.exchange(false, std::memory_order_acq_rel);
+
+	// For split-phase reads, collect the response to the request sent in the last cycle, and send the request for the next one
+	if (_splitPhaseRead)
+	{
+		// The response must be collected even if we skip the read, so that it does not remain on the wire. If the read state was
+		// updated from a write, the request may predate the write, so the value is discarded.
+		if (_readRequestPending.load(std::memory_order_acquire))
+		{
+			receiveReadResponse(skipRead);
+		}
+		// Don't send the next request if we skip the read, or if the response showed that the connection was lost
+		if (skipRead || !_ioComponent.get().connected())
+		{
+			return;
+		}
+		sendReadRequest(timeStamp);
+		return;
+	}
+
+	if (skipRead)
+	{
+		return;
+	}
+
 	// Read the data
-	read(context.scheduledTime());
+	read(timeStamp);
 }
 
 auto TemplateOutput::read(std::chrono::system_clock::time_point timeStamp) -> void
 {
+	Tracer::Span span { _ioComponent.get().tracer(), "read"sv };
+
 	try
 	{
-		/// @todo read the value
-		double value = {};
+		const auto requestTime = std::chrono::steady_clock::now();
 
-		/// @todo if the read function does not throw errors, but uses return types or internal handle state,
-		// throw an std::system_error here on failure, or call handleReadError() directly.
+		// Read the value
+		const auto value = _ioComponent.get().handle().read(_addressRange);
 
 		// The read was successful
+		_ioComponent.get().statistics().recordRead(std::chrono::steady_clock::now() - requestTime);
 		_readState.update(timeStamp, value);
 	}
 	catch (const std::exception &)
@@ -92,6 +223,57 @@ auto TemplateOutput::read(std::chrono::system_clock::time_point timeStamp) -> vo
 	}
 }
 
+auto TemplateOutput::sendReadRequest(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	try
+	{
+		_readRequestTime = std::chrono::steady_clock::now();
+
+		// Send the read request without waiting for the response
+		_ioComponent.get().handle().sendReadRequest(_addressRange);
+
+		// Remember to collect the response
+		_readRequestPending.store(true, std::memory_order_release);
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleReadError(timeStamp, error);
+	}
+}
+
+auto TemplateOutput::receiveReadResponse(bool discard) -> void
+{
+	// The request is no longer pending, whatever happens
+	_readRequestPending.store(false, std::memory_order_release);
+
+	try
+	{
+		/// @todo If your protocol library delivers responses asynchronously, you can also call this function from its completion
+		// handler instead of from performRead().
+		const auto value = _ioComponent.get().handle().receiveReadResponse(_addressRange);
+
+		/// @todo use the time stamp provided by the device, if the protocol has one
+		const auto responseTime = std::chrono::system_clock::now();
+
+		// The read was successful
+		_ioComponent.get().statistics().recordRead(std::chrono::steady_clock::now() - _readRequestTime);
+		if (!discard)
+		{
+			_readState.update(responseTime, value);
+		}
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleReadError(std::chrono::system_clock::now(), error);
+	}
+}
+
 auto TemplateOutput::handleReadError(std::chrono::system_clock::time_point timeStamp, std::error_code error)
 	-> void
 {
@@ -101,37 +283,130 @@ auto TemplateOutput::handleReadError(std::chrono::system_clock::time_point timeS
 	_ioComponent.get().handleError(timeStamp, error, this);
 }
 
-auto TemplateOutput::performWriteTask(const process::ExecutionContext &context) -> void
+auto TemplateOutput::performWrite(std::chrono::system_clock::time_point timeStamp) -> void
 {
-	// Only perform the read only if the I/O component is connected
+	// Only perform the write only if the I/O component is connected
 	if (!_ioComponent.get().connected())
 	{
 		return;
 	}
 
 	// Write the data
-	write(context.scheduledTime());
+	write(timeStamp);
+}
+
+auto TemplateOutput::hasPendingValue() const noexcept -> bool
+{
+	if (_writeQueue)
+	{
+		return !_writeBatch.empty() || _writeQueue->size() != 0;
+	}
+
+	return !_pendingOutputValue.empty();
 }
 
 auto TemplateOutput::write(std::chrono::system_clock::time_point timeStamp) -> void
 {
+	Tracer::Span span { _ioComponent.get().tracer(), "write"sv };
+
+	// Outputs in a write group are only ever written together with the rest of the group by the I/O component
+	if (_writeGroup != 0)
+	{
+		return;
+	}
+
+	// Don't ask for a token if there is nothing to write, so that idle outputs are not counted as throttled
+	if (!hasPendingValue())
+	{
+		return;
+	}
+
+	// Wait for the write rate limit of the I/O component. If we have to wait, any pending value stays pending, and is
+	// replaced by newer values unless we have a write queue.
+	if (!_ioComponent.get().tryAcquireWriteToken())
+	{
+		return;
+	}
+
+	// Write all the queued values if we have a write queue
+	if (_writeQueue)
+	{
+		writeQueued(timeStamp);
+		return;
+	}
+
 	// Get the value
 	auto pendingValue = _pendingOutputValue.dequeue();
-	// If there was no pending value, just bail
+	// If the value was taken by the batch write of the I/O component in the meantime, give back the token and bail
 	if (!pendingValue)
 	{
+		_ioComponent.get().refundWriteToken();
+		return;
+	}
+	// Get the time the value was scheduled
+	const auto pendingSince = takePendingSince();
+
+	// Don't send the value if the device already has it
+	if (isRedundantWrite(timeStamp, *pendingValue))
+	{
+		_ioComponent.get().refundWriteToken();
+		_writeState.suppress(timeStamp);
+		return;
+	}
+
+	// Use a combined transaction if the value must be read back
+	if (_readBackOnWrite)
+	{
+		writeAndReadBack(timeStamp, *pendingValue, pendingSince);
 		return;
 	}
 
 	try
 	{
-		/// @todo write the value
+		const auto requestTime = std::chrono::steady_clock::now();
 
-		/// @todo if the write function does not throw errors, but uses return types or internal handle state,
-		// throw an std::system_error here on failure, or call handleWriteError() directly.
+		// Write the value
+		_ioComponent.get().handle().write(_addressRange, *pendingValue);
 
 		// The write was successful
+		const auto deviceLatency = std::chrono::steady_clock::now() - requestTime;
+		writeSucceeded(timeStamp, *pendingValue);
+		_writeState.update(timeStamp, std::error_code());
+		recordWriteLatency(pendingSince, deviceLatency);
+		_ioComponent.get().statistics().recordWrite(deviceLatency);
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+		// Handle the error
+		handleWriteError(timeStamp, error);
+		recordWriteLatency(pendingSince, std::nullopt);
+	}
+}
+
+auto TemplateOutput::writeAndReadBack(std::chrono::system_clock::time_point timeStamp,
+	double value,
+	std::optional<std::chrono::steady_clock::time_point> pendingSince) -> void
+{
+	try
+	{
+		const auto requestTime = std::chrono::steady_clock::now();
+
+		// Write the value and read it back using a single transaction
+		/// @todo if only the read back can fail, call handleReadError() after updating the write state instead
+		const auto readBackValue = _ioComponent.get().handle().writeAndReadBack(_addressRange, value);
+
+		// The write was successful. Both states are updated using the same time stamp, because they come from the same response.
+		const auto deviceLatency = std::chrono::steady_clock::now() - requestTime;
+		writeSucceeded(timeStamp, value);
 		_writeState.update(timeStamp, std::error_code());
+		_readState.update(timeStamp, readBackValue);
+		recordWriteLatency(pendingSince, deviceLatency);
+		_ioComponent.get().statistics().recordWrite(deviceLatency);
+
+		// We already have a fresh value, so the next read is not needed
+		_skipNextRead.store(true, std::memory_order_release);
 	}
 	catch (const std::exception &)
 	{
@@ -139,14 +414,264 @@ auto TemplateOutput::write(std::chrono::system_clock::time_point timeStamp) -> v
 		const auto error = utils::eh::currentErrorCode();
 		// Handle the error
 		handleWriteError(timeStamp, error);
+		recordWriteLatency(pendingSince, std::nullopt);
 	}
 }
 
-auto TemplateOutput::handleWriteError(std::chrono::system_clock::time_point timeStamp, std::error_code error)
+auto TemplateOutput::writeQueued(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Collect all the values that are currently in the queue. Values enqueued while we do this will be written next time.
+	// The batch may still contain values from the last request if the connection was lost, which are written first, so the
+	// values stay in order.
+	while (_writeBatch.size() < _writeBatch.capacity())
+	{
+		auto value = _writeQueue->tryDequeue();
+		if (!value)
+		{
+			break;
+		}
+		_writeBatch.push_back(*value);
+	}
+	// If the values were taken by the batch write of the I/O component in the meantime, give back the token and bail
+	if (_writeBatch.empty())
+	{
+		_ioComponent.get().refundWriteToken();
+		return;
+	}
+	// Get the time the oldest value in the batch was scheduled
+	const auto pendingSince = takePendingSince();
+
+	try
+	{
+		const auto requestTime = std::chrono::steady_clock::now();
+
+		// Write all the values in a single request, in order
+		_ioComponent.get().handle().writeSequence(_addressRange, _writeBatch);
+
+		// The write was successful. The last value written is the one the device has now.
+		const auto deviceLatency = std::chrono::steady_clock::now() - requestTime;
+		writeThrough(timeStamp, _writeBatch.back());
+		_writeBatch.clear();
+		_writeState.update(timeStamp, std::error_code(), queueDepth());
+		recordWriteLatency(pendingSince, deviceLatency);
+		_ioComponent.get().statistics().recordWrite(deviceLatency);
+	}
+	catch (const std::exception &)
+	{
+		// Get the error from the current exception using this special utility function
+		const auto error = utils::eh::currentErrorCode();
+
+		// If the connection was lost, the device never got the values, so we keep them to write them again once we are
+		// reconnected. Otherwise, the device rejected them, and they are lost. This is reported by the write error.
+		const auto retry = TemplateIoComponent::isConnectionError(error);
+		if (retry)
+		{
+			restorePendingSince(pendingSince);
+		}
+		else
+		{
+			_writeBatch.clear();
+			recordWriteLatency(pendingSince, std::nullopt);
+		}
+
+		// Handle the error
+		handleWriteError(timeStamp, error, queueDepth());
+	}
+}
+
+auto TemplateOutput::queueDepth() const noexcept -> std::size_t
+{
+	return _writeBatch.size() + _writeQueue->size();
+}
+
+auto TemplateOutput::isRedundantWrite(std::chrono::system_clock::time_point timeStamp, double value) -> bool
+{
+	// Write every value if write-on-change is disabled
+	if (!_writeOnChange)
+	{
+		return false;
+	}
+
+	// The "batchWrite" task of the I/O component may be writing a value at the same time
+	std::scoped_lock lock { _lastWrittenMutex };
+
+	// Forget the last value if the device may have lost it
+	if (_lastWrittenValueInvalid.exchange(false, std::memory_order_acq_rel))
+	{
+		_lastWrittenValue.reset();
+	}
+
+	// Write the value if it differs from the one the device has
+	if (!_lastWrittenValue || *_lastWrittenValue != value)
+	{
+		return false;
+	}
+
+	// Write the value anyway if it is due for a refresh
+	if (_writeRefreshInterval.count() > 0 && timeStamp - _lastWrittenTime >= _writeRefreshInterval)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+auto TemplateOutput::writeSucceeded(std::chrono::system_clock::time_point timeStamp, double value) -> void
+{
+	// Remember the value for write-on-change suppression
+	rememberWrittenValue(timeStamp, value);
+
+	// Update the read state, if requested
+	writeThrough(timeStamp, value);
+}
+
+auto TemplateOutput::writeSucceeded(std::chrono::system_clock::time_point timeStamp, double value, process::DynamicEventList &events) -> void
+{
+	// Remember the value for write-on-change suppression
+	rememberWrittenValue(timeStamp, value);
+
+	// Update the read state, if requested, leaving the events to the caller
+	writeThrough(timeStamp, value, events);
+}
+
+auto TemplateOutput::rememberWrittenValue(std::chrono::system_clock::time_point timeStamp, double value) -> void
+{
+	if (!_writeOnChange)
+	{
+		return;
+	}
+
+	std::scoped_lock lock { _lastWrittenMutex };
+	_lastWrittenValue = value;
+	_lastWrittenTime = timeStamp;
+}
+
+auto TemplateOutput::writeThrough(std::chrono::system_clock::time_point timeStamp, double value) -> void
+{
+	if (!_writeThrough)
+	{
+		return;
+	}
+
+	// The device now has the value we wrote, so we can use it without reading it back
+	_readState.updateFromWrite(timeStamp, value);
+	_skipNextRead.store(true, std::memory_order_release);
+}
+
+auto TemplateOutput::writeThrough(std::chrono::system_clock::time_point timeStamp, double value, process::DynamicEventList &events) -> void
+{
+	if (!_writeThrough)
+	{
+		return;
+	}
+
+	// The device now has the value we wrote, so we can use it without reading it back
+	_readState.updateFromWrite(timeStamp, value, events);
+	_skipNextRead.store(true, std::memory_order_release);
+}
+
+auto TemplateOutput::scheduleOutputValue(double value) noexcept -> std::error_code
+{
+	// Just replace the pending value if we don't have a write queue
+	if (!_writeQueue)
+	{
+		_pendingOutputValue.enqueue(value);
+		markPending();
+		// Tell the I/O component that there is something to write
+		_ioComponent.get().markWriteDirty(*this);
+		return {};
+	}
+
+	// Queued values are not marked dirty, because the "batchWrite" task only writes a single value per data point.
+	// Data points with a write queue must be written using their own "write" task.
+
+	// Try to enqueue the value
+	if (_writeQueue->tryEnqueue(value))
+	{
+		markPending();
+		return {};
+	}
+
+	// The queue is full
+	switch (_queueOverflowPolicy)
+	{
+	case QueueOverflowPolicy::DropOldest:
+		// Discard old values until there is room. The write task may make room at the same time, so we just try again each time.
+		do
+		{
+			_writeQueue->tryDequeue();
+		} while (!_writeQueue->tryEnqueue(value));
+		markPending();
+		return {};
+
+	case QueueOverflowPolicy::DropNewest:
+		return {};
+
+	case QueueOverflowPolicy::Reject:
+	default:
+		return CustomError::WriteQueueFull;
+	}
+}
+
+auto TemplateOutput::markPending() noexcept -> void
+{
+	// Only record the time if no older value is waiting, so that we measure the latency of the oldest value
+	const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+	std::chrono::steady_clock::rep expected = 0;
+	_pendingSince.compare_exchange_strong(expected, now, std::memory_order_relaxed);
+}
+
+auto TemplateOutput::takePendingSince() noexcept -> std::optional<std::chrono::steady_clock::time_point>
+{
+	const auto pendingSince = _pendingSince.exchange(0, std::memory_order_relaxed);
+	if (pendingSince == 0)
+	{
+		return std::nullopt;
+	}
+	return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(pendingSince));
+}
+
+auto TemplateOutput::restorePendingSince(std::optional<std::chrono::steady_clock::time_point> pendingSince) noexcept -> void
+{
+	// Any time recorded in the meantime belongs to a newer value, so we simply replace it
+	if (pendingSince)
+	{
+		_pendingSince.store(pendingSince->time_since_epoch().count(), std::memory_order_relaxed);
+	}
+}
+
+auto TemplateOutput::recordWriteLatency(std::optional<std::chrono::steady_clock::time_point> pendingSince,
+	std::optional<std::chrono::nanoseconds> deviceLatency) -> void
+{
+	// The latencies are recorded for the I/O component as well
+	auto &ioComponentLatency = _ioComponent.get().writeLatency();
+
+	// Record the time the device took
+	if (deviceLatency)
+	{
+		_writeLatency.recordDevice(*deviceLatency);
+		ioComponentLatency.recordDevice(*deviceLatency);
+	}
+
+	// Record the time since the value was scheduled
+	if (pendingSince)
+	{
+		const auto endToEndLatency = std::chrono::steady_clock::now() - *pendingSince;
+		_writeLatency.recordEndToEnd(endToEndLatency);
+		ioComponentLatency.recordEndToEnd(endToEndLatency);
+	}
+}
+
+auto TemplateOutput::publishWriteStatistics(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	_writeLatency.publish(timeStamp);
+}
+
+auto TemplateOutput::handleWriteError(std::chrono::system_clock::time_point timeStamp, std::error_code error, std::size_t queueDepth)
 	-> void
 {
 	// Update our own state
-	_writeState.update(timeStamp, error);
+	_writeState.update(timeStamp, error, queueDepth);
 	// Notify the I/O component
 	_ioComponent.get().handleError(timeStamp, error, this);
 }
@@ -170,7 +695,16 @@ auto TemplateOutput::forEachAttribute(const model::ForEachAttributeFunction &fun
 		// Handle the read state attributes
 		_readState.forEachAttribute(function) ||
 		// Handle the write state attributes
-		_writeState.forEachAttribute(function);
+		_writeState.forEachAttribute(function) ||
+		// Handle the write latency attributes
+		_writeLatency.forEachAttribute(function) ||
+		// Handle the task monitor attributes
+		_readTask.monitor().forEachAttribute(function) ||
+		_writeTask.monitor().forEachAttribute(function) ||
+		// Handle the write queue depth, if we have a write queue
+		(_writeQueueSize > 0 && function(attributes::kWriteQueueDepth)) ||
+		// Handle the write derived flag, if we use write-through
+		(_writeThrough && function(attributes::kWriteDerived));
 
 	/// @todo handle any additional attributes this class supports, including attributes inherited from the I/O component
 }
@@ -181,7 +715,10 @@ auto TemplateOutput::forEachEvent(const model::ForEachEventFunction &function) -
 		// Handle the read state events
 		_readState.forEachEvent(function, sharedFromThis()) ||
 		// Handle the write state events
-		_writeState.forEachEvent(function, sharedFromThis());
+		_writeState.forEachEvent(function, sharedFromThis()) ||
+		// Handle the task monitor events
+		_readTask.monitor().forEachEvent(function, sharedFromThis()) ||
+		_writeTask.monitor().forEachEvent(function, sharedFromThis());
 
 	/// @todo handle any additional events this class supports, including events inherited from the I/O component
 }
@@ -214,6 +751,30 @@ auto TemplateOutput::makeReadHandle(const model::Attribute &attribute) const noe
 	{
 		return handle;
 	}
+	// Handle the write latency attributes
+	if (auto handle = _writeLatency.makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	// Handle the task monitor attributes
+	if (auto handle = _readTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	if (auto handle = _writeTask.monitor().makeReadHandle(attribute))
+	{
+		return handle;
+	}
+	// Handle the write queue depth, if we have a write queue
+	if (_writeQueueSize > 0 && attribute == attributes::kWriteQueueDepth)
+	{
+		return _writeState.queueDepthReadHandle();
+	}
+	// Handle the write derived flag, if we use write-through
+	if (_writeThrough && attribute == attributes::kWriteDerived)
+	{
+		return _readState.writeDerivedReadHandle();
+	}
 
 	/// @todo handle any additional readable attributes this class supports, including attributes inherited from the I/O component
 
@@ -238,8 +799,19 @@ auto TemplateOutput::makeWriteHandle(const model::Attribute &attribute) noexcept
 auto TemplateOutput::realize() -> void
 {
 	// Realize the state objects
+	_readState.setTracer(_ioComponent.get().tracer());
 	_readState.realize();
 	_writeState.realize();
+	_writeLatency.realize();
+	_readTask.monitor().realize();
+	_writeTask.monitor().realize();
+
+	// Create the write queue, if requested
+	if (_writeQueueSize > 0)
+	{
+		_writeQueue.emplace(_writeQueueSize);
+		_writeBatch.reserve(_writeQueue->capacity());
+	}
 }
 
 auto TemplateOutput::ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
@@ -247,10 +819,106 @@ auto TemplateOutput::ioComponentStateChanged(std::chrono::system_clock::time_poi
 	// We cannot reset the error to Ok because we don't have a value. So we use the special custom error code instead.
 	auto effectiveError = error ? error : CustomError::NoData;
 
+	// Any split-phase read request that was sent before is lost
+	_readRequestPending.store(false, std::memory_order_release);
+	// The device may have lost the values we wrote, e.g. if it was restarted
+	_lastWrittenValueInvalid.store(true, std::memory_order_release);
+
 	// Update the read state. We do not notify the I/O component, because that is who this message comes from in the first place.
 	// Note: the write state is not updated, because the write state simply contains the last write error, which is unaffected
 	// by I/O component errors.
 	_readState.update(timeStamp, utils::eh::unexpected(effectiveError));
 }
 
+auto TemplateOutput::ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp,
+	std::error_code error,
+	process::DynamicEventList &events) -> void
+{
+	// We cannot reset the error to Ok because we don't have a value. So we use the special custom error code instead.
+	auto effectiveError = error ? error : CustomError::NoData;
+
+	// Any split-phase read request that was sent before is lost
+	_readRequestPending.store(false, std::memory_order_release);
+	// The device may have lost the values we wrote, e.g. if it was restarted
+	_lastWrittenValueInvalid.store(true, std::memory_order_release);
+
+	// Update the read state, leaving the events to the I/O component
+	_readState.update(timeStamp, utils::eh::unexpected(effectiveError), events);
+}
+
+auto TemplateOutput::batchReadCompleted(std::chrono::system_clock::time_point timeStamp,
+	const utils::eh::expected<double, std::error_code> &valueOrError) -> void
+{
+	// Skip the update if the read state was just updated from a write. The block may have been read before the write.
+	if (_skipNextRead.exchange(false, std::memory_order_acq_rel))
+	{
+		return;
+	}
+
+	// Update the read state. The I/O component has already handled any errors that affect it.
+	_readState.update(timeStamp, valueOrError);
+}
+
+auto TemplateOutput::dequeueBatchWriteValue(std::chrono::system_clock::time_point timeStamp) -> std::optional<double>
+{
+	// Get the value
+	auto pendingValue = _pendingOutputValue.dequeue();
+	if (!pendingValue)
+	{
+		return std::nullopt;
+	}
+
+	// Get the time the value was scheduled
+	const auto pendingSince = takePendingSince();
+
+	// Leave the value out of the batch if the device already has it
+	if (isRedundantWrite(timeStamp, *pendingValue))
+	{
+		_writeState.suppress(timeStamp);
+		return std::nullopt;
+	}
+
+	// Remember the value, so we know what was written once the batch has completed
+	_batchWriteValue = *pendingValue;
+	_batchPendingSince = pendingSince;
+	return pendingValue;
+}
+
+auto TemplateOutput::restoreBatchWriteValue() noexcept -> void
+{
+	// Put the value back, unless a newer one was scheduled in the meantime
+	_pendingOutputValue.restore(_batchWriteValue);
+	restorePendingSince(_batchPendingSince);
+}
+
+auto TemplateOutput::batchWriteCompleted(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
+{
+	// Remember the value for write-on-change suppression and write-through
+	if (!error)
+	{
+		writeSucceeded(timeStamp, _batchWriteValue);
+	}
+
+	// Update the write state. The I/O component handles any errors that affect it.
+	_writeState.update(timeStamp, error);
+	// The I/O component records the device latency of the batch
+	recordWriteLatency(_batchPendingSince, std::nullopt);
+}
+
+auto TemplateOutput::batchWriteCompleted(std::chrono::system_clock::time_point timeStamp,
+	std::error_code error,
+	process::DynamicEventList &events) -> void
+{
+	// Remember the value for write-on-change suppression and write-through, leaving the events to the I/O component
+	if (!error)
+	{
+		writeSucceeded(timeStamp, _batchWriteValue, events);
+	}
+
+	// Update the write state, leaving the events to the I/O component
+	_writeState.update(timeStamp, error, events);
+	// The I/O component records the device latency of the batch
+	recordWriteLatency(_batchPendingSince, std::nullopt);
+}
+
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -2,18 +2,28 @@
 #pragma once
 
 #include "TemplateIoComponent.hpp"
+#include "BoundedQueue.hpp"
 #include "ReadState.hpp"
 #include "WriteState.hpp"
 #include "ReadTask.hpp"
+#include "TaskMonitor.hpp"
 #include "SingleValueQueue.hpp"
+#include "WriteLatencyState.hpp"
 #include "WriteTask.hpp"
 
 #include <xentara/process/Task.hpp>
 #include <xentara/skill/DataPoint.hpp>
 #include <xentara/skill/EnableSharedFromThis.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <optional>
 #include <string_view>
+#include <system_error>
+#include <vector>
 
 namespace xentara::plugins::templateDriver
 {
@@ -22,7 +32,12 @@ using namespace std::literals;
 
 /// @brief A class representing a specific type of output.
 /// @todo rename this class to something more descriptive
-class TemplateOutput final : public skill::DataPoint, public TemplateIoComponent::ErrorSink, public skill::EnableSharedFromThis<TemplateOutput>
+class TemplateOutput final :
+	public skill::DataPoint,
+	public TemplateIoComponent::ErrorSink,
+	public TemplateIoComponent::ReadSink,
+	public TemplateIoComponent::WriteSink,
+	public skill::EnableSharedFromThis<TemplateOutput>
 {
 public:
 	/// @brief The class object containing meta-information about this element type
@@ -37,6 +52,8 @@ public:
 		_ioComponent(ioComponent)
 	{
 		ioComponent.get().addErrorSink(*this);
+		ioComponent.get().addReadSink(*this);
+		ioComponent.get().addWriteSink(*this);
 	}
 	
 	/// @name Virtual Overrides for skill::DataPoint
@@ -63,6 +80,50 @@ public:
 
 	auto ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void final;
 
+	auto ioComponentStateChanged(std::chrono::system_clock::time_point timeStamp,
+		std::error_code error,
+		process::DynamicEventList &events) -> void final;
+
+	/// @}
+
+	/// @name Virtual Overrides for TemplateIoComponent::ReadSink and TemplateIoComponent::WriteSink
+	/// @{
+
+	auto addressRange() const noexcept -> AddressRange final
+	{
+		return _addressRange;
+	}
+
+	/// @}
+
+	/// @name Virtual Overrides for TemplateIoComponent::ReadSink
+	/// @{
+
+	auto batchReadCompleted(std::chrono::system_clock::time_point timeStamp,
+		const utils::eh::expected<double, std::error_code> &valueOrError) -> void final;
+
+	/// @}
+
+	/// @name Virtual Overrides for TemplateIoComponent::WriteSink
+	/// @{
+
+	auto writeGroup() const noexcept -> std::uint32_t final
+	{
+		return _writeGroup;
+	}
+
+	auto dequeueBatchWriteValue(std::chrono::system_clock::time_point timeStamp) -> std::optional<double> final;
+
+	auto restoreBatchWriteValue() noexcept -> void final;
+
+	auto batchWriteCompleted(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void final;
+
+	auto batchWriteCompleted(std::chrono::system_clock::time_point timeStamp,
+		std::error_code error,
+		process::DynamicEventList &events) -> void final;
+
+	auto publishWriteStatistics(std::chrono::system_clock::time_point timeStamp) -> void final;
+
 	/// @}
 
 	/// @brief A Xentara attribute containing the current value.
@@ -71,10 +132,27 @@ public:
 	static const model::Attribute kValueAttribute;
 
 private:
+	/// @brief What to do when a value is written while the write queue is full
+	enum class QueueOverflowPolicy
+	{
+		/// @brief Discard the oldest value in the queue to make room
+		DropOldest,
+		/// @brief Discard the new value
+		DropNewest,
+		/// @brief Discard the new value, and report an error to the writer
+		Reject
+	};
+
 	// The tasks need access to out private member functions
 	friend class ReadTask<TemplateOutput>;
 	friend class WriteTask<TemplateOutput>;
 
+	/// @brief This function is forwarded to the I/O component.
+	auto ioWorker() noexcept -> IoWorker *
+	{
+		return _ioComponent.get().ioWorker();
+	}
+
 	/// @brief This function is forwarded to the I/O component.
 	auto requestConnect(std::chrono::system_clock::time_point timeStamp) noexcept -> void
 	{
@@ -87,32 +165,88 @@ private:
 		_ioComponent.get().requestDisconnect(timeStamp);
 	}
 
-	/// @brief This function is called by the "read" task.
+	/// @brief Attempts to read the value if the I/O component is up.
 	///
-	/// This function attempts to read the value if the I/O component is up.
-	auto performReadTask(const process::ExecutionContext &context) -> void;
+	/// This function is called either by the "read" task, or on the I/O thread of the I/O component.
+	auto performRead(std::chrono::system_clock::time_point timeStamp) -> void;
 	/// @brief Attempts to read the data from the I/O component and updates the state accordingly.
 	auto read(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Sends a read request to the I/O component without waiting for the response.
+	///
+	/// This is used for split-phase reads. The response is collected by receiveReadResponse() during the next cycle.
+	auto sendReadRequest(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Receives the response to a read request sent by sendReadRequest() and updates the state accordingly.
+	///
+	/// The state is updated using the time the response was received, rather than the time the request was scheduled.
+	/// @param discard Whether to discard the value, because the request was sent before the read state was updated from a write.
+	/// Errors are still handled.
+	auto receiveReadResponse(bool discard = false) -> void;
 	/// @brief Handles a read error
 	auto handleReadError(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
 
-	/// @brief This function is called by the "write" task.
+	/// @brief Attempts to write any pending value if the I/O component is up.
 	///
-	/// This function attempts to write the value if the I/O component is up.
-	auto performWriteTask(const process::ExecutionContext &context) -> void;
+	/// This function is called either by the "write" task, or on the I/O thread of the I/O component.
+	auto performWrite(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Checks whether any value is waiting to be written, either in the write queue or as the pending value
+	/// @note The result is only a snapshot if other threads are using the queue at the same time.
+	auto hasPendingValue() const noexcept -> bool;
 	/// @brief Attempts to write any pending value to the I/O component and updates the state accordingly.
 	auto write(std::chrono::system_clock::time_point timeStamp) -> void;	
+	/// @brief Writes a value and reads it back from the device in a single transaction, and updates both states accordingly.
+	/// @param pendingSince The time the value was scheduled, as returned by takePendingSince()
+	/// @todo use the correct value type
+	auto writeAndReadBack(std::chrono::system_clock::time_point timeStamp,
+		double value,
+		std::optional<std::chrono::steady_clock::time_point> pendingSince) -> void;
+	/// @brief Attempts to write all values in the write queue to the I/O component in a single request.
+	auto writeQueued(std::chrono::system_clock::time_point timeStamp) -> void;
+	/// @brief Gets the number of values waiting to be written, for data points with a write queue
+	/// @note The result is only a snapshot if other threads are using the queue at the same time.
+	auto queueDepth() const noexcept -> std::size_t;
+	/// @brief Checks whether writing a value can be skipped because the device already has it
+	/// @todo use the correct value type
+	auto isRedundantWrite(std::chrono::system_clock::time_point timeStamp, double value) -> bool;
+	/// @brief Remembers a value that was successfully written, for write-on-change suppression and write-through
+	/// @todo use the correct value type
+	auto writeSucceeded(std::chrono::system_clock::time_point timeStamp, double value) -> void;
+	/// @brief Remembers a value that was successfully written, but leaves raising any read state events to the caller
+	/// @param events A list that any events that must be raised are appended to
+	/// @todo use the correct value type
+	auto writeSucceeded(std::chrono::system_clock::time_point timeStamp, double value, process::DynamicEventList &events) -> void;
+	/// @brief Remembers a value that was successfully written for write-on-change suppression
+	/// @todo use the correct value type
+	auto rememberWrittenValue(std::chrono::system_clock::time_point timeStamp, double value) -> void;
+	/// @brief Updates the read state with a value that was successfully written, if write-through is enabled
+	/// @todo use the correct value type
+	auto writeThrough(std::chrono::system_clock::time_point timeStamp, double value) -> void;
+	/// @brief Updates the read state with a value that was successfully written, if write-through is enabled, but leaves
+	/// raising the events to the caller
+	/// @param events A list that any events that must be raised are appended to
+	/// @todo use the correct value type
+	auto writeThrough(std::chrono::system_clock::time_point timeStamp, double value, process::DynamicEventList &events) -> void;
+	/// @brief Records that values are waiting to be written, unless older values are already waiting
+	auto markPending() noexcept -> void;
+	/// @brief Gets the time the oldest value that is waiting to be written was scheduled, and resets it
+	/// @return The time, or std::nullopt if no value was scheduled since the last call
+	auto takePendingSince() noexcept -> std::optional<std::chrono::steady_clock::time_point>;
+	/// @brief Puts back the time returned by takePendingSince() if the values could not be written, and will be written again later
+	auto restorePendingSince(std::optional<std::chrono::steady_clock::time_point> pendingSince) noexcept -> void;
+	/// @brief Records the latencies of a write whose result was just committed to the write state
+	/// @param pendingSince The time the value was scheduled, as returned by takePendingSince()
+	/// @param deviceLatency The time the device took to acknowledge the write, or std::nullopt if unknown
+	auto recordWriteLatency(std::optional<std::chrono::steady_clock::time_point> pendingSince,
+		std::optional<std::chrono::nanoseconds> deviceLatency) -> void;
 	/// @brief Handles a write error
-	auto handleWriteError(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
+	/// @param queueDepth The number of values still waiting to be written, for data points that have a write queue
+	auto handleWriteError(std::chrono::system_clock::time_point timeStamp, std::error_code error, std::size_t queueDepth = 0) -> void;
 
 	/// @brief Schedules a value to be written.
 	/// 
 	/// This function is called by the value write handle.
+	/// @return An error if the value was rejected because the write queue is full
 	/// @todo use the correct value type
-	auto scheduleOutputValue(double value) noexcept
-	{
-		_pendingOutputValue.enqueue(value);
-	}
+	auto scheduleOutputValue(double value) noexcept -> std::error_code;
 
 	/// @name Virtual Overrides for skill::DataPoint
 	/// @{
@@ -127,20 +261,82 @@ private:
 	/// @todo give this a more descriptive name, e.g. "_device"
 	std::reference_wrapper<TemplateIoComponent> _ioComponent;
 
+	/// @brief Whether to use split-phase reads, where the request is sent in one cycle, and the response is collected in the next
+	bool _splitPhaseRead { false };
+	/// @brief Whether a split-phase read request was sent, and its response has not been collected yet
+	std::atomic<bool> _readRequestPending { false };
+	/// @brief The time the pending split-phase read request was sent. This is set before _readRequestPending.
+	std::chrono::steady_clock::time_point _readRequestTime;
+
+	/// @brief The device addresses of the output
+	/// @todo set the size to the number of address units occupied by the value type
+	AddressRange _addressRange;
+
 	/// @brief The read state
 	/// @todo use the correct value type
 	ReadState<double> _readState;
 	/// @brief The write state
 	WriteState _writeState;
+	/// @brief The write latency statistics
+	WriteLatencyState _writeLatency;
 
 	/// @brief The queue for the pending output value
 	/// @todo use the correct value type
 	SingleValueQueue<double> _pendingOutputValue;
 
+	/// @brief The capacity of the write queue, or 0 to only write the latest value using _pendingOutputValue
+	std::size_t _writeQueueSize { 0 };
+	/// @brief What to do if the write queue is full
+	QueueOverflowPolicy _queueOverflowPolicy { QueueOverflowPolicy::DropOldest };
+	/// @brief The queue for the pending output values, if all values must be written in order
+	/// @todo use the correct value type
+	std::optional<BoundedQueue<double>> _writeQueue;
+	/// @brief The write group the output belongs to, or 0 for none
+	std::uint32_t _writeGroup { 0 };
+
+	/// @brief Whether to update the read state with each value successfully written, instead of reading it back
+	bool _writeThrough { false };
+	/// @brief Whether to read the value back in the same transaction that writes it
+	bool _readBackOnWrite { false };
+	/// @brief Set after the read state was updated by a write, so that the next read can be skipped
+	std::atomic<bool> _skipNextRead { false };
+
+	/// @brief Whether to skip writing values that are equal to the last value successfully written
+	bool _writeOnChange { false };
+	/// @brief The maximum time after which an unchanged value is written again anyway, or 0 for none
+	std::chrono::nanoseconds _writeRefreshInterval { 0 };
+	/// @brief A mutex protecting _lastWrittenValue and _lastWrittenTime, which are used by both the "write" task of the output
+	/// and the "batchWrite" task of the I/O component
+	std::mutex _lastWrittenMutex;
+	/// @brief The last value that was successfully written, or std::nullopt if it is unknown what value the device has.
+	/// @todo use the correct value type
+	std::optional<double> _lastWrittenValue;
+	/// @brief The time _lastWrittenValue was written
+	std::chrono::system_clock::time_point _lastWrittenTime;
+	/// @brief The value currently being written by the "batchWrite" task of the I/O component
+	/// @note This is only used by the "batchWrite" task of the I/O component, never by the "write" task of the output.
+	/// @todo use the correct value type
+	double _batchWriteValue {};
+	/// @brief The time the value in _batchWriteValue was scheduled
+	/// @note This is only used by the "batchWrite" task of the I/O component, never by the "write" task of the output.
+	std::optional<std::chrono::steady_clock::time_point> _batchPendingSince;
+	/// @brief Set by other threads if the device may have lost the last value written, e.g. because the connection was lost
+	std::atomic<bool> _lastWrittenValueInvalid { false };
+
+	/// @brief The time the oldest value that has not been written yet was scheduled, as a steady clock tick count,
+	/// or 0 if no value is waiting to be written
+	std::atomic<std::chrono::steady_clock::rep> _pendingSince { 0 };
+
+	/// @brief A buffer used to collect the queued values for a single write request. If the connection is lost during the request,
+	/// the values are kept here, and written first once the connection is back.
+	/// @note This is preallocated in realize(), so that writing does not allocate memory.
+	/// @todo use the correct value type
+	std::vector<double> _writeBatch;
+
 	/// @brief The "read" task
-	ReadTask<TemplateOutput> _readTask { *this };
+	ReadTask<TemplateOutput> _readTask { *this, TaskMonitor::kReadRoles };
 	/// @brief The "write" task
-	WriteTask<TemplateOutput> _writeTask { *this };
+	WriteTask<TemplateOutput> _writeTask { *this, TaskMonitor::kWriteRoles };
 };
 
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright (c) embedded ocean GmbH
+#include "TokenBucket.hpp"
+
+#include <algorithm>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto TokenBucket::configure(double rate, double burst) -> void
+{
+	std::scoped_lock lock { _mutex };
+
+	_rate = rate;
+	_burst = std::max(burst, 1.0);
+	_tokens = _burst;
+	_lastRefill = std::chrono::steady_clock::now();
+}
+
+auto TokenBucket::tryAcquire() -> bool
+{
+	// Always succeed if the rate is not limited
+	if (!enabled())
+	{
+		return true;
+	}
+
+	std::scoped_lock lock { _mutex };
+
+	// Add any new tokens
+	refill();
+
+	// Take a token, if there is one
+	if (_tokens < 1.0)
+	{
+		return false;
+	}
+	_tokens -= 1.0;
+	return true;
+}
+
+auto TokenBucket::refund() -> void
+{
+	// Nothing to do if the rate is not limited
+	if (!enabled())
+	{
+		return;
+	}
+
+	std::scoped_lock lock { _mutex };
+
+	_tokens = std::min(_tokens + 1.0, _burst);
+}
+
+auto TokenBucket::refill() -> void
+{
+	// Read the clock under the lock, so that no other thread can have moved _lastRefill past it
+	const auto now = std::chrono::steady_clock::now();
+
+	// Add tokens for the time that has passed, up to the maximum
+	const auto elapsed = std::chrono::duration<double>(now - _lastRefill).count();
+	_tokens = std::min(_tokens + elapsed * _rate, _burst);
+	_lastRefill = now;
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
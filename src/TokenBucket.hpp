@@ -0,0 +1,56 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Limits the rate of operations using a token bucket.
+///
+/// The bucket is refilled continuously at a fixed rate, up to a maximum number of tokens that determines how many
+/// operations may be performed in a burst. Each operation takes one token. Taking a token never blocks, so the caller
+/// must simply try again later if no token was available.
+///
+/// This class is thread-safe.
+class TokenBucket final
+{
+public:
+	/// @brief Sets the rate and the burst size, and fills the bucket.
+	/// @param rate The number of tokens added per second, or 0 for no limit
+	/// @param burst The maximum number of tokens the bucket can hold. Must be at least 1.
+	auto configure(double rate, double burst) -> void;
+
+	/// @brief Checks whether the rate is limited at all
+	auto enabled() const noexcept -> bool
+	{
+		return _rate > 0;
+	}
+
+	/// @brief Attempts to take a token
+	/// @return true if a token was taken, or false if the bucket was empty
+	auto tryAcquire() -> bool;
+
+	/// @brief Returns a token that was taken, but not used
+	auto refund() -> void;
+
+private:
+	/// @brief Adds the tokens that have accumulated since the last refill
+	/// @note The mutex must be locked when calling this function
+	auto refill() -> void;
+
+	/// @brief The number of tokens added per second, or 0 for no limit
+	double _rate { 0 };
+	/// @brief The maximum number of tokens
+	double _burst { 1 };
+
+	/// @brief A mutex protecting the following members
+	std::mutex _mutex;
+	/// @brief The current number of tokens
+	double _tokens { 1 };
+	/// @brief The last time the tokens were refilled
+	std::chrono::steady_clock::time_point _lastRefill;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
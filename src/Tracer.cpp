@@ -0,0 +1,179 @@
+// Copyright (c) embedded ocean GmbH
+#include "Tracer.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+
+namespace xentara::plugins::templateDriver
+{
+
+namespace
+{
+
+/// @brief The ID the next tracer will get
+std::atomic<std::uint64_t> gNextTracerId { 1 };
+
+/// @brief Converts a duration to microseconds, which is the unit used by the Chrome trace event format
+auto toMicroseconds(std::chrono::steady_clock::duration duration) -> double
+{
+	return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+} // namespace
+
+/// @note Entries for tracers that have been destroyed stay in the cache, but their IDs are never reused.
+class Tracer::ThreadCache final
+{
+public:
+	/// @brief An entry in the cache
+	struct Entry final
+	{
+		/// @brief The ID of the tracer the buffer belongs to
+		std::uint64_t _tracerId;
+		/// @brief The buffer
+		std::shared_ptr<Buffer> _buffer;
+	};
+
+	/// @brief Destructor. This is called when the thread exits.
+	~ThreadCache()
+	{
+		for (auto &&entry : _entries)
+		{
+			entry._buffer->release();
+		}
+	}
+
+	/// @brief The entries
+	std::vector<Entry> _entries;
+};
+
+thread_local Tracer::ThreadCache Tracer::tThreadCache;
+
+Tracer::Tracer() : _id(gNextTracerId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+auto Tracer::Buffer::push(const Event &event) noexcept -> void
+{
+	// Drop the event if the buffer is full
+	const auto head = _head.load(std::memory_order_relaxed);
+	if (head - _tail.load(std::memory_order_acquire) >= kCapacity)
+	{
+		_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	// Store the event, and then publish it to the reader
+	_events[head % kCapacity] = event;
+	_head.store(head + 1, std::memory_order_release);
+}
+
+template <std::invocable<const Tracer::Event &> Function>
+auto Tracer::Buffer::drain(Function &&function) -> std::uint64_t
+{
+	// Read all the events published so far
+	const auto tail = _tail.load(std::memory_order_relaxed);
+	const auto head = _head.load(std::memory_order_acquire);
+	for (auto index = tail; index != head; ++index)
+	{
+		function(_events[index % kCapacity]);
+	}
+
+	// Give the space back to the writer
+	_tail.store(head, std::memory_order_release);
+
+	return _dropped.exchange(0, std::memory_order_relaxed);
+}
+
+auto Tracer::threadBuffer() -> Buffer &
+{
+	// Look in the cache first
+	auto &entries = tThreadCache._entries;
+	const auto cached = std::ranges::find(entries, _id, &ThreadCache::Entry::_tracerId);
+	if (cached != entries.end())
+	{
+		return *cached->_buffer;
+	}
+
+	// Create a new buffer. The thread index is only used to tell the threads apart in the file.
+	std::scoped_lock lock { _mutex };
+	const auto &buffer = _buffers.emplace_back(std::make_shared<Buffer>(_nextThreadIndex++));
+	entries.push_back({ _id, buffer });
+	return *buffer;
+}
+
+auto Tracer::flush(const std::filesystem::path &path) -> std::error_code
+{
+	// Open the file before draining the buffers, so that the events are not lost if the file cannot be opened
+	const auto mode = _fileCreated ? std::ios::out | std::ios::app : std::ios::out | std::ios::trunc;
+	std::ofstream file { path, mode };
+	if (!file)
+	{
+		return std::make_error_code(std::errc::io_error);
+	}
+	// Write the times with nanosecond resolution, and never in scientific notation
+	file << std::fixed << std::setprecision(3);
+
+	// A new file starts with the opening bracket of the event array. The closing bracket is optional in the Chrome
+	// trace event format, so we can keep appending events on later flushes.
+	if (!_fileCreated)
+	{
+		file << "[\n";
+		_fileCreated = true;
+	}
+
+	// Get a snapshot of the buffers. The snapshot shares ownership, so we can drain them without holding the lock.
+	std::vector<std::shared_ptr<Buffer>> buffers;
+	{
+		std::scoped_lock lock { _mutex };
+		buffers = _buffers;
+	}
+
+	// Write a complete event for each span
+	bool anyReleased = false;
+	for (auto &&buffer : buffers)
+	{
+		// Check whether the thread has exited before draining, so that we know no more events can follow
+		const auto released = buffer->released();
+		anyReleased = anyReleased || released;
+
+		const auto threadIndex = buffer->threadIndex();
+		const auto dropped = buffer->drain([&](const Event &event) {
+			file << R"({"name":")" << event._name << R"(","cat":"templateDriver","ph":"X","pid":1,"tid":)" << threadIndex
+				<< R"(,"ts":)" << toMicroseconds(event._startTime - _epoch) << R"(,"dur":)" << toMicroseconds(event._duration) << "},\n";
+		});
+
+		// Record dropped spans as an instant event, so that gaps in the timeline can be explained
+		if (dropped > 0)
+		{
+			file << R"({"name":"droppedSpans","cat":"templateDriver","ph":"i","s":"t","pid":1,"tid":)" << threadIndex
+				<< R"(,"ts":)" << toMicroseconds(std::chrono::steady_clock::now() - _epoch) << R"(,"args":{"count":)" << dropped << "}},\n";
+		}
+
+		// Forget the buffer if its thread has exited. It is freed when the snapshot goes away.
+		if (!released)
+		{
+			buffer.reset();
+		}
+	}
+
+	// Remove the buffers of threads that have exited, which are the ones still left in the snapshot
+	if (anyReleased)
+	{
+		std::scoped_lock lock { _mutex };
+		std::erase_if(_buffers, [&](const std::shared_ptr<Buffer> &buffer) { return std::ranges::find(buffers, buffer) != buffers.end(); });
+	}
+
+	// Check that everything was written
+	file.flush();
+	if (!file)
+	{
+		return std::make_error_code(std::errc::io_error);
+	}
+
+	return {};
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,184 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Records spans of time spent in driver operations, and writes them to a file in the Chrome trace event format.
+///
+/// Each thread records its spans into a lock-free ring buffer of its own, so recording never blocks, and threads never
+/// contend with each other. Only the first span a thread records on a tracer takes a lock, to create the thread's buffer.
+/// If a buffer is full, further spans are dropped until the next flush, and the number of dropped spans is written to the file.
+/// When a thread exits, its buffer is freed by the next flush, after its last spans were written.
+///
+/// The resulting file can be loaded into chrome://tracing or https://ui.perfetto.dev to view a timeline of all threads.
+class Tracer final
+{
+private:
+	// Forward declaration for use in Span
+	class Buffer;
+
+public:
+	/// @brief Records the time between its construction and its destruction as a span.
+	///
+	/// If the tracer is a null pointer, the span does nothing, so that tracing costs only a single check when disabled.
+	class Span final
+	{
+	public:
+		/// @brief Starts the span
+		/// @param tracer The tracer to record the span on, or nullptr if tracing is disabled
+		/// @param name The name of the span. This must refer to a string with static storage duration, e.g. a literal.
+		Span(Tracer *tracer, std::string_view name) : _name(name)
+		{
+			if (tracer)
+			{
+				_buffer = &tracer->threadBuffer();
+				_startTime = std::chrono::steady_clock::now();
+			}
+		}
+
+		/// @brief Ends the span, and records it
+		~Span()
+		{
+			if (_buffer)
+			{
+				_buffer->push({ _name, _startTime, std::chrono::steady_clock::now() - _startTime });
+			}
+		}
+
+		/// @brief Spans cannot be copied
+		Span(const Span &) = delete;
+		/// @brief Spans cannot be copied
+		auto operator=(const Span &) -> Span & = delete;
+
+	private:
+		/// @brief The buffer of the current thread, or nullptr if tracing is disabled
+		Buffer *_buffer { nullptr };
+		/// @brief The name of the span
+		std::string_view _name;
+		/// @brief The time the span started
+		std::chrono::steady_clock::time_point _startTime;
+	};
+
+	/// @brief Constructor
+	Tracer();
+
+	/// @brief Writes all the spans recorded since the last flush to a file, and removes them from the buffers.
+	///
+	/// The first flush replaces any existing file, later flushes append to it.
+	/// @param path The path of the file
+	/// @return A default constructed std::error_code object on success, or the error that occurred
+	/// @note This function must not be called from more than one thread at a time.
+	auto flush(const std::filesystem::path &path) -> std::error_code;
+
+private:
+	/// @brief A recorded span
+	struct Event final
+	{
+		/// @brief The name of the span
+		std::string_view _name;
+		/// @brief The time the span started
+		std::chrono::steady_clock::time_point _startTime;
+		/// @brief The length of the span
+		std::chrono::steady_clock::duration _duration;
+	};
+
+	/// @brief A ring buffer of spans recorded by a single thread.
+	///
+	/// The buffer is written by its thread, and read by the thread that flushes the tracer.
+	class Buffer final
+	{
+	public:
+		/// @brief Constructor
+		/// @param threadIndex The index of the thread, used as thread ID in the file
+		explicit Buffer(std::size_t threadIndex) : _threadIndex(threadIndex)
+		{
+		}
+
+		/// @brief Called when the thread exits, so that the tracer can free the buffer once it was drained
+		auto release() noexcept -> void
+		{
+			_released.store(true, std::memory_order_release);
+		}
+
+		/// @brief Checks whether the thread has exited. If so, no more events will be pushed.
+		auto released() const noexcept -> bool
+		{
+			return _released.load(std::memory_order_acquire);
+		}
+
+		/// @brief Adds an event, or drops it if the buffer is full
+		auto push(const Event &event) noexcept -> void;
+
+		/// @brief Removes all the events from the buffer, and calls a function for each of them
+		/// @return The number of events dropped since the last call
+		template <std::invocable<const Event &> Function>
+		auto drain(Function &&function) -> std::uint64_t;
+
+		/// @brief Gets the index of the thread
+		auto threadIndex() const noexcept -> std::size_t
+		{
+			return _threadIndex;
+		}
+
+	private:
+		/// @brief The number of events the buffer can hold. This must be a power of two.
+		static constexpr std::size_t kCapacity = 4096;
+
+		/// @brief The index of the thread
+		std::size_t _threadIndex;
+		/// @brief The events
+		std::array<Event, kCapacity> _events;
+		/// @brief The number of events ever pushed
+		std::atomic<std::size_t> _head { 0 };
+		/// @brief The number of events ever drained
+		std::atomic<std::size_t> _tail { 0 };
+		/// @brief The number of events dropped since the last drain
+		std::atomic<std::uint64_t> _dropped { 0 };
+		/// @brief Whether the thread has exited
+		std::atomic<bool> _released { false };
+	};
+
+	/// @brief The buffers of the current thread on all tracers, which are released when the thread exits
+	class ThreadCache;
+
+	/// @brief Gets the buffer of the current thread, creating it if necessary
+	auto threadBuffer() -> Buffer &;
+
+	/// @brief The buffers of the current thread, so that recording a span need not take a lock
+	static thread_local ThreadCache tThreadCache;
+
+	/// @brief A unique ID for this tracer, used to find the buffer of the current thread.
+	///
+	/// We use an ID rather than the address, because a new tracer might be constructed at the address of one that was destroyed.
+	const std::uint64_t _id;
+
+	/// @brief The time all the time stamps in the file are relative to
+	const std::chrono::steady_clock::time_point _epoch { std::chrono::steady_clock::now() };
+
+	/// @brief A mutex protecting _buffers and _nextThreadIndex
+	std::mutex _mutex;
+	/// @brief The buffers of all the threads that have recorded spans. The buffers are shared with the threads, so that a
+	/// thread that exits after the tracer was destroyed can still release its buffer.
+	std::vector<std::shared_ptr<Buffer>> _buffers;
+	/// @brief The index the next thread will get. Indices are not reused, so that the threads can be told apart in the file.
+	std::size_t _nextThreadIndex { 1 };
+
+	/// @brief Whether the file was already created by a previous flush
+	bool _fileCreated { false };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,148 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Keeps track of the requests that are in flight on a connection, so that responses can be matched to them.
+///
+/// Each request is assigned a transaction ID when it is sent. The window limits the number of requests that may be
+/// outstanding at the same time, and looks up the request belonging to a response using its transaction ID.
+///
+/// This class is not thread-safe. It must only be used by one thread at a time.
+/// @tparam Payload Information about the request that is needed to process the response
+template <typename Payload>
+class TransactionWindow final
+{
+public:
+	/// @brief The type used for transaction IDs
+	/// @todo use the transaction ID type of the protocol
+	using TransactionId = std::uint16_t;
+
+	/// @brief The maximum number of outstanding transactions.
+	///
+	/// This is half the number of transaction IDs, so that the IDs of outstanding transactions never wrap around, and
+	/// a late response to an old request cannot be mistaken for a response to a new one while the old ID is still recent.
+	static constexpr std::size_t kMaxSize = std::size_t(std::numeric_limits<TransactionId>::max()) / 2;
+
+	/// @brief Sets the maximum number of outstanding transactions.
+	///
+	/// This discards all outstanding transactions.
+	/// @param size The maximum number of outstanding transactions. This is clamped to between 1 and kMaxSize.
+	auto resize(std::size_t size) -> void
+	{
+		_slots.assign(std::clamp<std::size_t>(size, 1, kMaxSize), Slot {});
+		_outstanding = 0;
+	}
+
+	/// @brief Gets the number of outstanding transactions
+	auto outstanding() const noexcept -> std::size_t
+	{
+		return _outstanding;
+	}
+
+	/// @brief Checks whether the maximum number of transactions is outstanding
+	auto full() const noexcept -> bool
+	{
+		return _outstanding >= _slots.size();
+	}
+
+	/// @brief Starts a new transaction
+	/// @param payload Information about the request
+	/// @return The transaction ID to send with the request, or std::nullopt if the window is full
+	auto open(const Payload &payload) -> std::optional<TransactionId>
+	{
+		// Find a free slot
+		const auto slot = std::ranges::find_if(_slots, [](const Slot &slot) { return !slot._used; });
+		if (slot == _slots.end())
+		{
+			return std::nullopt;
+		}
+
+		// Fill the slot
+		*slot = { true, _nextTransactionId++, payload };
+		++_outstanding;
+
+		return slot->_transactionId;
+	}
+
+	/// @brief Completes the transaction belonging to a response
+	/// @param transactionId The transaction ID contained in the response
+	/// @return The payload of the transaction, or std::nullopt if no such transaction is outstanding,
+	/// e.g. because the response arrived too late.
+	auto close(TransactionId transactionId) -> std::optional<Payload>
+	{
+		// Find the slot with the transaction ID
+		const auto slot = std::ranges::find_if(
+			_slots, [&](const Slot &slot) { return slot._used && slot._transactionId == transactionId; });
+		if (slot == _slots.end())
+		{
+			return std::nullopt;
+		}
+
+		// Free the slot
+		slot->_used = false;
+		--_outstanding;
+
+		return slot->_payload;
+	}
+
+	/// @brief Gets the transaction that was opened first of all the outstanding ones.
+	///
+	/// This is the transaction a response belongs to if the protocol has no transaction IDs, and responses arrive in the
+	/// order the requests were sent.
+	/// @pre At least one transaction must be outstanding
+	auto oldest() const noexcept -> TransactionId
+	{
+		// The transaction ID counts up and wraps around, so the oldest transaction is the one furthest behind the next ID
+		const auto age = [&](const Slot &slot) {
+			return slot._used ? TransactionId(_nextTransactionId - slot._transactionId) : TransactionId(0);
+		};
+		return std::ranges::max_element(_slots, {}, age)->_transactionId;
+	}
+
+	/// @brief Aborts all outstanding transactions
+	/// @param function A function that is called with the payload of each aborted transaction
+	template <std::invocable<const Payload &> Function>
+	auto abort(Function &&function) -> void
+	{
+		for (auto &&slot : _slots)
+		{
+			if (slot._used)
+			{
+				slot._used = false;
+				function(slot._payload);
+			}
+		}
+		_outstanding = 0;
+	}
+
+private:
+	/// @brief A single outstanding transaction
+	struct Slot final
+	{
+		/// @brief Whether the slot is in use
+		bool _used { false };
+		/// @brief The transaction ID
+		TransactionId _transactionId { 0 };
+		/// @brief The payload
+		Payload _payload {};
+	};
+
+	/// @brief The slots, one for each transaction that may be outstanding
+	std::vector<Slot> _slots = std::vector<Slot>(1);
+	/// @brief The number of outstanding transactions
+	std::size_t _outstanding { 0 };
+	/// @brief The transaction ID to use for the next transaction
+	TransactionId _nextTransactionId { 0 };
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright (c) embedded ocean GmbH
+#include "WriteLatencyState.hpp"
+
+#include "Attributes.hpp"
+
+#include <xentara/memory/memoryResources.hpp>
+#include <xentara/memory/WriteSentinel.hpp>
+
+namespace xentara::plugins::templateDriver
+{
+
+auto WriteLatencyState::forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool
+{
+	// Handle all the attributes we support
+	return
+		function(attributes::kWriteLatencyP50) ||
+		function(attributes::kWriteLatencyP99) ||
+		function(attributes::kWriteLatencyMax) ||
+		function(attributes::kDeviceWriteLatencyP50) ||
+		function(attributes::kDeviceWriteLatencyP99) ||
+		function(attributes::kDeviceWriteLatencyMax);
+}
+
+auto WriteLatencyState::makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>
+{
+	// Try each readable attribute
+	if (attribute == attributes::kWriteLatencyP50)
+	{
+		return _dataBlock.member(&State::_endToEndP50);
+	}
+	else if (attribute == attributes::kWriteLatencyP99)
+	{
+		return _dataBlock.member(&State::_endToEndP99);
+	}
+	else if (attribute == attributes::kWriteLatencyMax)
+	{
+		return _dataBlock.member(&State::_endToEndMax);
+	}
+	else if (attribute == attributes::kDeviceWriteLatencyP50)
+	{
+		return _dataBlock.member(&State::_deviceP50);
+	}
+	else if (attribute == attributes::kDeviceWriteLatencyP99)
+	{
+		return _dataBlock.member(&State::_deviceP99);
+	}
+	else if (attribute == attributes::kDeviceWriteLatencyMax)
+	{
+		return _dataBlock.member(&State::_deviceMax);
+	}
+
+	return std::nullopt;
+}
+
+auto WriteLatencyState::realize() -> void
+{
+	// Create the data block
+	_dataBlock.create(memory::memoryResources::data());
+}
+
+auto WriteLatencyState::publish(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Don't touch the data block if nothing was recorded since last time
+	const auto count = _endToEnd.count() + _device.count();
+	if (_publishedCount.exchange(count, std::memory_order_relaxed) == count)
+	{
+		return;
+	}
+
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+	auto &state = *sentinel;
+
+	// Update the state. We must write all the members, because memory resources use swap-in.
+	state._endToEndP50 = _endToEnd.percentile(0.5);
+	state._endToEndP99 = _endToEnd.percentile(0.99);
+	state._endToEndMax = _endToEnd.max();
+	state._deviceP50 = _device.percentile(0.5);
+	state._deviceP99 = _device.percentile(0.99);
+	state._deviceMax = _device.max();
+
+	// Commit the data. There are no events to raise.
+	sentinel.commit(timeStamp);
+}
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
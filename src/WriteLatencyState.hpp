@@ -0,0 +1,85 @@
+// Copyright (c) embedded ocean GmbH
+#pragma once
+
+#include "LatencyHistogram.hpp"
+
+#include <xentara/data/ReadHandle.hpp>
+#include <xentara/memory/ObjectBlock.hpp>
+#include <xentara/model/ForEachAttributeFunction.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace xentara::plugins::templateDriver
+{
+
+/// @brief Latency statistics for write operations.
+///
+/// Two latencies are tracked: the end-to-end latency from the time a value was scheduled to the time the result of
+/// writing it was committed to the write state, and the time the device took to acknowledge the write request.
+/// Latencies can be recorded from any thread. The statistics are cumulative since the state was created.
+class WriteLatencyState final
+{
+public:
+	/// @brief Iterates over all the attributes that belong to this state.
+	/// @param function The function that should be called for each attribute
+	/// @return The return value of the last function call
+	auto forEachAttribute(const model::ForEachAttributeFunction &function) const -> bool;
+
+	/// @brief Creates a read-handle for an attribute that belong to this state.
+	/// @param attribute The attribute to create the handle for
+	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
+	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
+
+	/// @brief Realizes the state
+	auto realize() -> void;
+
+	/// @brief Records the time from scheduling a value to committing the result of writing it
+	auto recordEndToEnd(std::chrono::nanoseconds latency) noexcept -> void
+	{
+		_endToEnd.record(latency);
+	}
+
+	/// @brief Records the time the device took to acknowledge a write request
+	auto recordDevice(std::chrono::nanoseconds latency) noexcept -> void
+	{
+		_device.record(latency);
+	}
+
+	/// @brief Writes the current statistics to the data block, if anything was recorded since the last call
+	/// @param timeStamp The update time stamp
+	auto publish(std::chrono::system_clock::time_point timeStamp) -> void;
+
+private:
+	/// @brief This structure is used to represent the state inside the memory block
+	struct State final
+	{
+		/// @brief The median end-to-end latency
+		std::chrono::nanoseconds _endToEndP50 { 0 };
+		/// @brief The 99th percentile of the end-to-end latency
+		std::chrono::nanoseconds _endToEndP99 { 0 };
+		/// @brief The largest end-to-end latency
+		std::chrono::nanoseconds _endToEndMax { 0 };
+		/// @brief The median device latency
+		std::chrono::nanoseconds _deviceP50 { 0 };
+		/// @brief The 99th percentile of the device latency
+		std::chrono::nanoseconds _deviceP99 { 0 };
+		/// @brief The largest device latency
+		std::chrono::nanoseconds _deviceMax { 0 };
+	};
+
+	/// @brief The end-to-end latencies
+	LatencyHistogram _endToEnd;
+	/// @brief The device latencies
+	LatencyHistogram _device;
+
+	/// @brief The total number of latencies recorded at the time of the last call to publish()
+	std::atomic<std::uint64_t> _publishedCount { 0 };
+
+	/// @brief The data block that contains the state
+	memory::ObjectBlock<State> _dataBlock;
+};
+
+} // namespace xentara::plugins::templateDriver
\ No newline at end of file
@@ -19,7 +19,8 @@ auto WriteState::forEachAttribute(const model::ForEachAttributeFunction &functio
 	// Handle all the attributes we support
 	return
 		function(model::Attribute::kWriteTime) ||
-		function(attributes::kWriteError);
+		function(attributes::kWriteError) ||
+		function(attributes::kWriteSuppressed);
 }
 
 auto WriteState::forEachEvent(const model::ForEachEventFunction &function, std::shared_ptr<void> parent) -> bool
@@ -41,17 +42,26 @@ auto WriteState::makeReadHandle(const model::Attribute &attribute) const noexcep
 	{
 		return _dataBlock.member(&State::_writeError);
 	}
+	else if (attribute == attributes::kWriteSuppressed)
+	{
+		return _dataBlock.member(&State::_suppressed);
+	}
 
 	return std::nullopt;
 }
 
+auto WriteState::queueDepthReadHandle() const noexcept -> data::ReadHandle
+{
+	return _dataBlock.member(&State::_queueDepth);
+}
+
 auto WriteState::realize() -> void
 {
 	// Create the data block
 	_dataBlock.create(memory::memoryResources::data());
 }
 
-auto WriteState::update(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void
+auto WriteState::update(std::chrono::system_clock::time_point timeStamp, std::error_code error, std::size_t queueDepth) -> void
 {
 	// Make a write sentinel
 	memory::WriteSentinel sentinel { _dataBlock };
@@ -60,6 +70,8 @@ auto WriteState::update(std::chrono::system_clock::time_point timeStamp, std::er
 	// Update the state
 	state._writeTime = timeStamp;
 	state._writeError = error;
+	state._queueDepth = queueDepth;
+	state._suppressed = false;
 
 	// Determine the correct event
 	const auto &event = error ? _writeErrorEvent : _writtenEvent;
@@ -67,4 +79,40 @@ auto WriteState::update(std::chrono::system_clock::time_point timeStamp, std::er
 	sentinel.commit(timeStamp, event);
 }
 
+auto WriteState::update(std::chrono::system_clock::time_point timeStamp, std::error_code error, process::DynamicEventList &events)
+	-> void
+{
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+	auto &state = *sentinel;
+
+	// Update the state
+	state._writeTime = timeStamp;
+	state._writeError = error;
+	state._queueDepth = 0;
+	state._suppressed = false;
+
+	// Commit the data without raising any events
+	sentinel.commit(timeStamp);
+
+	// Let the caller raise the correct event
+	events.push_back(error ? _writeErrorEvent : _writtenEvent);
+}
+
+auto WriteState::suppress(std::chrono::system_clock::time_point timeStamp) -> void
+{
+	// Make a write sentinel
+	memory::WriteSentinel sentinel { _dataBlock };
+	auto &state = *sentinel;
+
+	// Update the state. We always need to write the queue depth, even though it is unchanged, because memory resources use swap-in.
+	state._writeTime = timeStamp;
+	state._writeError = {};
+	state._queueDepth = sentinel.oldValue()._queueDepth;
+	state._suppressed = true;
+
+	// Commit the data and raise the written event. The device has the value, so as far as anyone else is concerned, it was written.
+	sentinel.commit(timeStamp, _writtenEvent);
+}
+
 } // namespace xentara::plugins::templateDriver
\ No newline at end of file
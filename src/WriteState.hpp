@@ -8,9 +8,12 @@
 #include <xentara/model/ForEachAttributeFunction.hpp>
 #include <xentara/model/ForEachEventFunction.hpp>
 #include <xentara/process/Event.hpp>
+#include <xentara/process/EventList.hpp>
 
 #include <chrono>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <memory>
 
@@ -43,13 +46,30 @@ public:
 	/// @return A read handle for the attribute, or std::nullopt if the attribute is unknown
 	auto makeReadHandle(const model::Attribute &attribute) const noexcept -> std::optional<data::ReadHandle>;
 
+	/// @brief Creates a read-handle for the write queue depth attribute.
+	/// @note The write queue depth attribute is not handled by makeReadHandle(), because only data points with a write queue have it.
+	/// @return A read handle to the write queue depth attribute
+	auto queueDepthReadHandle() const noexcept -> data::ReadHandle;
+
 	/// @brief Realizes the state
 	auto realize() -> void;
 
 	/// @brief Updates the data and sends events
 	/// @param timeStamp The update time stamp
 	/// @param error The error code, or a default constructed std::error_code object if no error occurred
-	auto update(std::chrono::system_clock::time_point timeStamp, std::error_code error) -> void;
+	/// @param queueDepth The number of values still waiting to be written, for data points that have a write queue
+	auto update(std::chrono::system_clock::time_point timeStamp, std::error_code error, std::size_t queueDepth = 0) -> void;
+
+	/// @brief Updates the data, but leaves raising the events to the caller
+	/// @param timeStamp The update time stamp
+	/// @param error The error code, or a default constructed std::error_code object if no error occurred
+	/// @param events A list that the event that must be raised is appended to. The caller must raise this event
+	/// after the data was committed.
+	auto update(std::chrono::system_clock::time_point timeStamp, std::error_code error, process::DynamicEventList &events) -> void;
+
+	/// @brief Records that a write was skipped because the device already had the value, and sends events
+	/// @param timeStamp The update time stamp
+	auto suppress(std::chrono::system_clock::time_point timeStamp) -> void;
 
 private:
 	/// @brief This structure is used to represent the state inside the memory block
@@ -60,6 +80,10 @@ private:
 		/// @brief The error code when writing the value, or a default constructed std::error_code object for none.
 		/// @note The error is default initialized, because it is not an error if the value was never written.
 		std::error_code _writeError;
+		/// @brief The number of values still waiting to be written
+		std::uint64_t _queueDepth { 0 };
+		/// @brief Whether the last write was skipped because the device already had the value
+		bool _suppressed { false };
 	};
 
 	/// @brief A Xentara event that is raised when the value was successfully written
@@ -1,6 +1,9 @@
 // Copyright (c) embedded ocean GmbH
 #pragma once
 
+#include "IoWorker.hpp"
+#include "TaskMonitor.hpp"
+
 #include <xentara/process/Task.hpp>
 #include <xentara/process/ExecutionContext.hpp>
 
@@ -12,14 +15,29 @@ namespace xentara::plugins::templateDriver
 
 /// @brief This class providing callbacks for the Xentara scheduler for the "write" task of data points
 template <typename Target>
-class WriteTask final : public process::Task
+class WriteTask final : public process::Task, public IoWorker::Job
 {
 public:
 	/// @brief This constuctor attached the task to its target
-	WriteTask(std::reference_wrapper<Target> target) : _target(target)
+	/// @param target The target element
+	/// @param monitorRoles The attributes and the event of the task monitor of the task
+	WriteTask(std::reference_wrapper<Target> target, const TaskMonitor::Roles &monitorRoles) :
+		IoWorker::Job(&_monitor), _target(target), _monitor(monitorRoles)
 	{
 	}
 
+	/// @brief Gets the task monitor of the task
+	auto monitor() noexcept -> TaskMonitor &
+	{
+		return _monitor;
+	}
+
+	/// @brief Gets the task monitor of the task
+	auto monitor() const noexcept -> const TaskMonitor &
+	{
+		return _monitor;
+	}
+
 	/// @name Virtual Overrides for process::Task
 	/// @{
 
@@ -42,9 +60,21 @@ public:
 		
 	/// @}
 
+	/// @name Virtual Overrides for IoWorker::Job
+	/// @{
+
+	auto execute(std::chrono::system_clock::time_point timeStamp) -> void final
+	{
+		_target.get().performWrite(timeStamp);
+	}
+
+	/// @}
+
 private:
 	/// @brief A reference to the target element
 	std::reference_wrapper<Target> _target;
+	/// @brief The task monitor
+	TaskMonitor _monitor;
 };
 
 template <typename Target>
@@ -68,7 +98,18 @@ auto WriteTask<Target>::preOperational(const process::ExecutionContext &context)
 template <typename Target>
 auto WriteTask<Target>::operational(const process::ExecutionContext &context) -> void
 {
-	_target.get().performWriteTask(context);
+	// Hand the write off to the I/O thread, if the target has one. The I/O thread times the execution, so that the time
+	// the device takes counts towards overruns.
+	if (const auto ioWorker = _target.get().ioWorker())
+	{
+		ioWorker->post(*this, context.scheduledTime());
+		return;
+	}
+
+	// Perform the write directly, timing the execution
+	const auto execution = _monitor.start(context.scheduledTime());
+	_target.get().performWrite(context.scheduledTime());
+	_monitor.finish(execution);
 }
 
 template <typename Target>